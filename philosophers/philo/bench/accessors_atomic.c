@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   accessors_atomic.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:43:21 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 01:43:21 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/*
+atomic_cycle(): Replays the accessor traffic of one routine() iteration
+				(eat, sleep, think) through the real pull/push accessors.
+
+Parameters: philo - A pointer to the philosopher structure.
+
+Return value: None.
+*/
+static void	atomic_cycle(t_philo *philo)
+{
+	pull_philo_state(philo);
+	philo_death(philo);
+	pull_philo_state(philo);
+	pull_keep_iter(philo->data);
+	philo_death(philo);
+	pull_philo_state(philo);
+	pull_keep_iter(philo->data);
+	push_philo_state(philo, EATING);
+	pull_keep_iter(philo->data);
+	update_last_meal(philo);
+	update_n_meals(philo);
+	pull_philo_state(philo);
+	push_philo_state(philo, SLEEPING);
+	pull_philo_state(philo);
+	pull_keep_iter(philo->data);
+	pull_philo_state(philo);
+	push_philo_state(philo, THINKING);
+	pull_philo_state(philo);
+	pull_keep_iter(philo->data);
+}
+
+/*
+atomic_worker(): Runs n_cycles cycles for one philosopher.
+
+Parameters: arg_p - A void pointer to the worker's t_bench_arg.
+
+Return value: NULL.
+*/
+void	*atomic_worker(void *arg_p)
+{
+	t_bench_arg	*arg;
+	int			i;
+
+	arg = (t_bench_arg *)arg_p;
+	i = -1;
+	while (++i < arg->bench->n_cycles)
+		atomic_cycle(&arg->bench->data->philo[arg->i]);
+	return (NULL);
+}
+
+/*
+atomic_monitor(): Polls every philosopher without sleeping, the worst case
+					for the monitors' share of the contention.
+
+Parameters: bench_p - A void pointer to the benchmark structure.
+
+Return value: NULL.
+*/
+void	*atomic_monitor(void *bench_p)
+{
+	t_bench	*bench;
+	int		i;
+
+	bench = (t_bench *)bench_p;
+	while (atomic_load(&bench->running))
+	{
+		i = -1;
+		while (++i < bench->data->conf.n_philos)
+		{
+			philo_death(&bench->data->philo[i]);
+			pull_n_meals_had(&bench->data->philo[i]);
+		}
+	}
+	return (NULL);
+}
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   accessors_baseline.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:43:04 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 01:48:13 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/*
+l_pull_state(): Baseline pull_philo_state(), one mutex per scalar.
+
+Parameters: l - A pointer to the baseline philosopher state.
+
+Return value: The state of the philosopher.
+*/
+t_state	l_pull_state(t_locked *l)
+{
+	t_state	state;
+
+	pthread_mutex_lock(&l->state_mu);
+	state = l->state;
+	pthread_mutex_unlock(&l->state_mu);
+	return (state);
+}
+
+/*
+l_push_state(): Baseline push_philo_state(), one mutex per scalar.
+
+Parameters: l - A pointer to the baseline philosopher state.
+            state - The state to set the philosopher to.
+
+Return value: None.
+*/
+void	l_push_state(t_locked *l, t_state state)
+{
+	pthread_mutex_lock(&l->state_mu);
+	if (l->state != DEAD)
+		l->state = state;
+	pthread_mutex_unlock(&l->state_mu);
+}
+
+/*
+l_pull_last_meal(): Baseline pull_last_meal(), one mutex per scalar.
+
+Parameters: l - A pointer to the baseline philosopher state.
+
+Return value: The time of the last meal of the philosopher.
+*/
+u_int64_t	l_pull_last_meal(t_locked *l)
+{
+	u_int64_t	last_meal;
+
+	pthread_mutex_lock(&l->last_meal_mu);
+	last_meal = l->last_meal;
+	pthread_mutex_unlock(&l->last_meal_mu);
+	return (last_meal);
+}
+
+/*
+l_update_last_meal(): Baseline update_last_meal(), one mutex per scalar.
+
+Parameters: l - A pointer to the baseline philosopher state.
+
+Return value: None.
+*/
+void	l_update_last_meal(t_locked *l)
+{
+	pthread_mutex_lock(&l->last_meal_mu);
+	l->last_meal = get_time();
+	pthread_mutex_unlock(&l->last_meal_mu);
+}
+
+/*
+l_death(): Baseline philo_death(): time to die, last meal and state are read
+			under three different mutexes, so the pair is not a consistent
+			snapshot.
+
+Parameters: bench - A pointer to the benchmark structure.
+            l - A pointer to the baseline philosopher state.
+
+Return value: 1 if the philosopher is dead, 0 otherwise.
+*/
+int	l_death(t_bench *bench, t_locked *l)
+{
+	u_int64_t	us_todie;
+
+	pthread_mutex_lock(&bench->ms_todie_mu);
+	us_todie = bench->data->conf.us_todie;
+	pthread_mutex_unlock(&bench->ms_todie_mu);
+	if (get_time() - l_pull_last_meal(l) > us_todie
+		&& l_pull_state(l) != EATING)
+	{
+		l_push_state(l, DEAD);
+		return (1);
+	}
+	return (0);
+}
@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   accessors_counters.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:43:05 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 01:43:05 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/*
+l_update_n_meals(): Baseline update_n_meals(), one mutex per scalar.
+
+Parameters: l - A pointer to the baseline philosopher state.
+
+Return value: None.
+*/
+void	l_update_n_meals(t_locked *l)
+{
+	pthread_mutex_lock(&l->n_meals_mu);
+	l->n_meals++;
+	pthread_mutex_unlock(&l->n_meals_mu);
+}
+
+/*
+l_pull_n_meals(): Baseline pull_n_meals_had(), one mutex per scalar.
+
+Parameters: l - A pointer to the baseline philosopher state.
+
+Return value: The number of meals the philosopher has had.
+*/
+int	l_pull_n_meals(t_locked *l)
+{
+	int	n_meals;
+
+	pthread_mutex_lock(&l->n_meals_mu);
+	n_meals = l->n_meals;
+	pthread_mutex_unlock(&l->n_meals_mu);
+	return (n_meals);
+}
+
+/*
+l_pull_keep_iter(): Baseline pull_keep_iter(), guarded by a mutex.
+
+Parameters: bench - A pointer to the benchmark structure.
+
+Return value: The keep_iter flag.
+*/
+int	l_pull_keep_iter(t_bench *bench)
+{
+	int	keep_iter;
+
+	pthread_mutex_lock(&bench->keep_iter_mu);
+	keep_iter = bench->keep_iter;
+	pthread_mutex_unlock(&bench->keep_iter_mu);
+	return (keep_iter);
+}
+
+/*
+locked_init(): Allocates and initializes the baseline philosopher states.
+
+Parameters: bench - A pointer to the benchmark structure.
+            n - The number of philosophers.
+
+Return value: None.
+*/
+void	locked_init(t_bench *bench, int n)
+{
+	int	i;
+
+	bench->locked = malloc(sizeof(t_locked) * n);
+	if (bench->locked == NULL)
+		exit(1);
+	bench->keep_iter = 1;
+	pthread_mutex_init(&bench->keep_iter_mu, NULL);
+	pthread_mutex_init(&bench->ms_todie_mu, NULL);
+	i = -1;
+	while (++i < n)
+	{
+		bench->locked[i].n_meals = 0;
+		bench->locked[i].state = IDLE;
+		bench->locked[i].last_meal = get_time();
+		pthread_mutex_init(&bench->locked[i].n_meals_mu, NULL);
+		pthread_mutex_init(&bench->locked[i].last_meal_mu, NULL);
+		pthread_mutex_init(&bench->locked[i].state_mu, NULL);
+	}
+}
+
+/*
+locked_free(): Destroys and frees the baseline philosopher states.
+
+Parameters: bench - A pointer to the benchmark structure.
+            n - The number of philosophers.
+
+Return value: None.
+*/
+void	locked_free(t_bench *bench, int n)
+{
+	int	i;
+
+	i = -1;
+	while (++i < n)
+	{
+		pthread_mutex_destroy(&bench->locked[i].n_meals_mu);
+		pthread_mutex_destroy(&bench->locked[i].last_meal_mu);
+		pthread_mutex_destroy(&bench->locked[i].state_mu);
+	}
+	pthread_mutex_destroy(&bench->keep_iter_mu);
+	pthread_mutex_destroy(&bench->ms_todie_mu);
+	free(bench->locked);
+}
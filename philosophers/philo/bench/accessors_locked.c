@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   accessors_locked.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:43:21 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 01:43:21 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/*
+locked_cycle(): Replays the accessor traffic of one routine() iteration
+				(eat, sleep, think) against the baseline state.
+
+Parameters: bench - A pointer to the benchmark structure.
+            l - A pointer to the baseline philosopher state.
+
+Return value: None.
+*/
+static void	locked_cycle(t_bench *bench, t_locked *l)
+{
+	l_pull_state(l);
+	l_death(bench, l);
+	l_pull_state(l);
+	l_pull_keep_iter(bench);
+	l_death(bench, l);
+	l_pull_state(l);
+	l_pull_keep_iter(bench);
+	l_push_state(l, EATING);
+	l_pull_keep_iter(bench);
+	l_update_last_meal(l);
+	l_update_n_meals(l);
+	l_pull_state(l);
+	l_push_state(l, SLEEPING);
+	l_pull_state(l);
+	l_pull_keep_iter(bench);
+	l_pull_state(l);
+	l_push_state(l, THINKING);
+	l_pull_state(l);
+	l_pull_keep_iter(bench);
+}
+
+/*
+locked_worker(): Runs n_cycles baseline cycles for one philosopher.
+
+Parameters: arg_p - A void pointer to the worker's t_bench_arg.
+
+Return value: NULL.
+*/
+void	*locked_worker(void *arg_p)
+{
+	t_bench_arg	*arg;
+	int			i;
+
+	arg = (t_bench_arg *)arg_p;
+	i = -1;
+	while (++i < arg->bench->n_cycles)
+		locked_cycle(arg->bench, &arg->bench->locked[arg->i]);
+	return (NULL);
+}
+
+/*
+locked_monitor(): Polls every baseline philosopher without sleeping, the
+					worst case for the monitors' share of the contention.
+
+Parameters: bench_p - A void pointer to the benchmark structure.
+
+Return value: NULL.
+*/
+void	*locked_monitor(void *bench_p)
+{
+	t_bench	*bench;
+	int		i;
+
+	bench = (t_bench *)bench_p;
+	while (atomic_load(&bench->running))
+	{
+		i = -1;
+		while (++i < bench->data->conf.n_philos)
+		{
+			l_death(bench, &bench->locked[i]);
+			l_pull_n_meals(&bench->locked[i]);
+		}
+	}
+	return (NULL);
+}
@@ -0,0 +1,231 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:42:38 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:24:52 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BENCH_H
+# define BENCH_H
+
+# include "../include/philo.h"
+# include <time.h> //clock_gettime(): monotonic nanosecond timestamps
+# include <fcntl.h> //open(): /dev/null as the output of bench_format
+
+/*
+Benchmarks print one CSV row per measurement so results from two builds
+can be diffed directly: bench,variant,param,value
+*/
+
+/*
+t_locked: replica of the philosopher state as it was before the meal word,
+one mutex per scalar. Used as the baseline in bench_accessors.
+*/
+typedef struct s_locked
+{
+	int				n_meals;
+	u_int64_t		last_meal;
+	t_state			state;
+	pthread_mutex_t	n_meals_mu;
+	pthread_mutex_t	last_meal_mu;
+	pthread_mutex_t	state_mu;
+}	t_locked;
+
+typedef struct s_bench
+{
+	t_data			*data;
+	t_locked		*locked;
+	pthread_mutex_t	keep_iter_mu;
+	int				keep_iter;
+	pthread_mutex_t	ms_todie_mu;
+	int				n_cycles;
+	atomic_int		running;
+}	t_bench;
+
+/*
+bench_sleep keeps every overshoot of a run in samples, n_samples of them,
+for its percentiles.
+*/
+typedef struct s_sleep_bench
+{
+	u_int64_t			us;
+	int					n_sleeps;
+	int					legacy;
+	t_sleep				stats;
+	u_int64_t			*samples;
+	_Atomic u_int64_t	n_samples;
+}	t_sleep_bench;
+
+/*
+bench_des runs each configuration DES_BENCH_RUNS times and keeps the best.
+*/
+# define DES_BENCH_RUNS 3
+
+/*
+bench_co times CO_BENCH_SWITCHES coroutine switches and as many thread
+hand-offs: two threads taking turns through t_handoff, as two philosopher
+threads do through a fork.
+*/
+# define CO_BENCH_SWITCHES 1000000
+
+typedef struct s_handoff
+{
+	pthread_mutex_t	mu;
+	pthread_cond_t	cv;
+	int				turn;
+	int				n;
+}	t_handoff;
+
+typedef struct s_handoff_arg
+{
+	t_handoff	*h;
+	int			me;
+}	t_handoff_arg;
+
+/*
+bench_flock times FLOCK_BENCH_ITERS uncontended rounds of each --fork-lock
+lock, then makes two threads, two neighbours, take turns on one fork for
+FLOCK_BENCH_MS, each holding it FLOCK_BENCH_HOLD_US and asking for it
+again at once. released is when the fork was last dropped: a waiter
+that gets it after that counts the gap as the hand-off latency.
+*/
+# define FLOCK_BENCH_ITERS 1000000
+# define FLOCK_BENCH_MS 500
+# define FLOCK_BENCH_HOLD_US 20
+
+typedef struct s_flock_bench
+{
+	t_fork				*fork;
+	t_lock_kind			kind;
+	u_int64_t			end_ns;
+	_Atomic u_int64_t	released;
+}	t_flock_bench;
+
+typedef struct s_flock_arg
+{
+	t_flock_bench	*b;
+	t_mcs_node		node;
+	int				id;
+	u_int64_t		n;
+	u_int64_t		wait_max_ns;
+	u_int64_t		gap_ns;
+	u_int64_t		n_gaps;
+}	t_flock_arg;
+
+/*
+bench_prims calls get_time() and each accessor PRIMS_BENCH_CALLS times.
+*/
+# define PRIMS_BENCH_CALLS 10000000
+
+/*
+bench_print has 1 to 200 writer threads push PRINT_BENCH_EVENTS events in
+all through print_changestate(), while the log writer formats them into
+/dev/null.
+*/
+# define PRINT_BENCH_EVENTS 2000000
+
+/*
+bench_forks has the philosopher threads take and drop their forks through
+take_both() and drop_both() FORKS_BENCH_PAIRS times in all.
+*/
+# define FORKS_BENCH_PAIRS 200000
+
+/*
+bench_proc runs the simulation through philo(), with and without
+--processes, and reads back its --trace. Start-up is when the last odd
+philosopher starts its first meal: on an even table, they all eat at
+once. A hand-off runs from a neighbour's "is sleeping", logged right
+after it dropped its forks, to the next fork of a philosopher thinking
+since before that. A death runs from the deadline, last meal plus time
+to die, to the "died" record, over PROC_BENCH_DEATHS runs. A seat holds
+when its philosopher started thinking, was freed and last ate.
+*/
+# define PROC_BENCH_DEATHS 5
+# define PROC_BENCH_TRACE "/tmp/bench_proc.trace"
+
+typedef struct s_proc_seat
+{
+	u_int64_t	think;
+	u_int64_t	freed;
+	u_int64_t	ate;
+}	t_proc_seat;
+
+typedef struct s_proc_bench
+{
+	int			n;
+	u_int64_t	todie_us;
+	t_proc_seat	*seat;
+	u_int64_t	start_us;
+	u_int64_t	gap_us;
+	u_int64_t	n_gaps;
+	long		death_us;
+}	t_proc_bench;
+
+/*
+t_fmt: a log line formatter, compared against log_format() in bench_format.
+*/
+typedef size_t	(*t_fmt)(char *dst, u_int64_t ms, int id, t_msg msg);
+
+typedef struct s_bench_arg
+{
+	t_bench		*bench;
+	int			i;
+}	t_bench_arg;
+
+///////////////////////
+/////bench_utils.c/////
+///////////////////////
+u_int64_t	bench_now_ns(void);
+u_int64_t	bench_cpu_ns(void);
+void		bench_row(char *bench, char *variant, long param, double value);
+void		bench_data(t_data *data, char *n_philos, t_layout layout);
+t_bench_arg	*bench_args(t_bench *bench);
+
+///////////////////////
+/////bench_stats.c/////
+///////////////////////
+void		bench_sort(u_int64_t *v, size_t n);
+u_int64_t	bench_pct(u_int64_t *v, size_t n, double pct);
+
+//////////////////////
+/////bench_perf.c/////
+//////////////////////
+int			bench_perf_open(void);
+long long	bench_perf_close(int fd);
+
+//////////////////////////////
+/////accessors_baseline.c/////
+//////////////////////////////
+t_state		l_pull_state(t_locked *l);
+void		l_push_state(t_locked *l, t_state state);
+u_int64_t	l_pull_last_meal(t_locked *l);
+void		l_update_last_meal(t_locked *l);
+int			l_death(t_bench *bench, t_locked *l);
+
+//////////////////////////////
+/////accessors_counters.c/////
+//////////////////////////////
+void		l_update_n_meals(t_locked *l);
+int			l_pull_n_meals(t_locked *l);
+int			l_pull_keep_iter(t_bench *bench);
+void		locked_init(t_bench *bench, int n);
+void		locked_free(t_bench *bench, int n);
+
+////////////////////////////
+/////accessors_locked.c/////
+////////////////////////////
+void		*locked_worker(void *arg_p);
+void		*locked_monitor(void *bench_p);
+
+////////////////////////////
+/////accessors_atomic.c/////
+////////////////////////////
+void		*atomic_worker(void *arg_p);
+void		*atomic_monitor(void *bench_p);
+
+#endif
@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_accessors.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:43:21 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 01:46:55 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/*
+run_variant(): Measures the per-cycle accessor overhead of one variant.
+
+Parameters: bench - A pointer to the benchmark structure.
+            worker - The worker routine of the variant.
+            monitor - The monitor routine of the variant.
+            variant - The name of the variant, for the report.
+
+Return value: None.
+
+How it works:
+1. Starts the monitor, which polls every philosopher until the end.
+2. Starts one worker per philosopher and waits for all of them.
+3. Prints the wall time of the run divided by the cycles of one worker:
+	the time one philosopher spends in accessors per routine() iteration.
+*/
+static void	run_variant(t_bench *bench, void *(*worker)(void *),
+		void *(*monitor)(void *), char *variant)
+{
+	t_bench_arg	arg[200];
+	pthread_t	monit;
+	u_int64_t	start;
+	int			i;
+
+	atomic_store(&bench->running, 1);
+	pthread_create(&monit, NULL, monitor, bench);
+	start = bench_now_ns();
+	i = -1;
+	while (++i < bench->data->conf.n_philos)
+	{
+		arg[i].bench = bench;
+		arg[i].i = i;
+		pthread_create(&bench->data->philo_th[i], NULL, worker, &arg[i]);
+	}
+	i = -1;
+	while (++i < bench->data->conf.n_philos)
+		pthread_join(bench->data->philo_th[i], NULL);
+	bench_row("accessors", variant, bench->data->conf.n_philos,
+		(double)(bench_now_ns() - start) / bench->n_cycles);
+	atomic_store(&bench->running, 0);
+	pthread_join(monit, NULL);
+}
+
+/*
+main(): Compares the mutex-per-scalar accessors (locked) with the packed
+		atomic meal word (atomic), for 1 to 200 philosopher threads.
+
+Return value: 0.
+*/
+int	main(void)
+{
+	static char	*sizes[] = {"1", "4", "16", "200", NULL};
+	t_bench		bench;
+	t_data		data;
+	int			i;
+
+	printf("bench,variant,threads,ns_per_cycle\n");
+	i = -1;
+	while (sizes[++i])
+	{
+		bench_data(&data, sizes[i], LAYOUT_PADDED);
+		bench.data = &data;
+		bench.n_cycles = 2000000 / data.conf.n_philos;
+		locked_init(&bench, data.conf.n_philos);
+		run_variant(&bench, &locked_worker, &locked_monitor, "locked");
+		run_variant(&bench, &atomic_worker, &atomic_monitor, "atomic");
+		locked_free(&bench, data.conf.n_philos);
+		free_data(&data);
+	}
+	return (0);
+}
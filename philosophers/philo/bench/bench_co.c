@@ -0,0 +1,145 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_co.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:30:25 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 02:30:53 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+static ucontext_t	g_main;
+static ucontext_t	g_co;
+
+/*
+co_pong(): A coroutine that switches straight back, forever.
+
+Parameters: None.
+
+Return value: None, it never returns.
+*/
+static void	co_pong(void)
+{
+	while (1)
+		swapcontext(&g_co, &g_main);
+}
+
+/*
+bench_switch(): Times a switch between two coroutines.
+
+Parameters: None.
+
+Return value: The time of one switch, in nanoseconds.
+
+How it works:
+1. Prepares a coroutine on a CO_STACK_SIZE stack, as co_init() does.
+2. Switches to it and back CO_BENCH_SWITCHES times: two switches per round
+	trip, each a swapcontext() as in co_switch() and co_park().
+*/
+static double	bench_switch(void)
+{
+	static char	stack[CO_STACK_SIZE];
+	u_int64_t	start;
+	int			i;
+
+	getcontext(&g_co);
+	g_co.uc_stack.ss_sp = stack;
+	g_co.uc_stack.ss_size = CO_STACK_SIZE;
+	g_co.uc_link = &g_main;
+	makecontext(&g_co, &co_pong, 0);
+	start = bench_now_ns();
+	i = -1;
+	while (++i < CO_BENCH_SWITCHES / 2)
+		swapcontext(&g_main, &g_co);
+	return ((double)(bench_now_ns() - start) / CO_BENCH_SWITCHES);
+}
+
+/*
+handoff_routine(): One of the two threads taking turns.
+
+Parameters: arg_p - A void pointer to a t_handoff_arg: the hand-off and
+				the turn of this thread, 0 or 1.
+
+Return value: NULL.
+
+How it works:
+1. Waits for its turn on the condition variable, then passes the turn to
+	the other thread, CO_BENCH_SWITCHES / 2 times.
+*/
+static void	*handoff_routine(void *arg_p)
+{
+	t_handoff	*h;
+	int			me;
+	int			i;
+
+	h = ((t_handoff_arg *)arg_p)->h;
+	me = ((t_handoff_arg *)arg_p)->me;
+	i = -1;
+	pthread_mutex_lock(&h->mu);
+	while (++i < h->n)
+	{
+		while (h->turn != me)
+			pthread_cond_wait(&h->cv, &h->mu);
+		h->turn = !me;
+		pthread_cond_signal(&h->cv);
+	}
+	pthread_mutex_unlock(&h->mu);
+	return (NULL);
+}
+
+/*
+bench_handoff(): Times a hand-off between two threads.
+
+Parameters: None.
+
+Return value: The time of one hand-off, in nanoseconds.
+
+How it works:
+1. Runs two handoff_routine() threads until they have passed the turn
+	CO_BENCH_SWITCHES times in total: each pass is a wake-up through
+	the kernel, as when a philosopher thread waits for a fork.
+*/
+static double	bench_handoff(void)
+{
+	t_handoff		h;
+	t_handoff_arg	args[2];
+	pthread_t		th[2];
+	u_int64_t		start;
+
+	pthread_mutex_init(&h.mu, NULL);
+	pthread_cond_init(&h.cv, NULL);
+	h.turn = 0;
+	h.n = CO_BENCH_SWITCHES / 2;
+	args[0].h = &h;
+	args[0].me = 0;
+	args[1].h = &h;
+	args[1].me = 1;
+	start = bench_now_ns();
+	pthread_create(&th[0], NULL, &handoff_routine, &args[0]);
+	pthread_create(&th[1], NULL, &handoff_routine, &args[1]);
+	pthread_join(th[0], NULL);
+	pthread_join(th[1], NULL);
+	start = bench_now_ns() - start;
+	pthread_mutex_destroy(&h.mu);
+	pthread_cond_destroy(&h.cv);
+	return ((double)start / CO_BENCH_SWITCHES);
+}
+
+/*
+main(): Compares a coroutine switch with a thread hand-off.
+
+Parameters: None.
+
+Return value: 0.
+*/
+int	main(void)
+{
+	printf("bench,variant,switches,value\n");
+	bench_row("switch_ns", "coroutine", CO_BENCH_SWITCHES, bench_switch());
+	bench_row("switch_ns", "thread", CO_BENCH_SWITCHES, bench_handoff());
+	return (0);
+}
@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_des.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:24:06 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 04:08:09 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/*
+des_once(): Runs one virtual-time simulation and times it.
+
+Parameters: n_philos - The number of philosophers, as a decimal string.
+            workers - The number of workers the table is cut into.
+            null_fd - A descriptor of /dev/null, where the log goes.
+
+Return value: The wall time of the simulation, in milliseconds.
+
+How it works:
+1. Sets the simulation up as philo() does with --virtual-time and
+	--workers: 800 200 200 with 10 meals each.
+2. Points stdout to /dev/null while the simulation runs, so the log
+	writer does not time the terminal.
+*/
+static double	des_once(char *n_philos, int workers, int null_fd)
+{
+	static char	*av[] = {"bench", NULL, "800", "200", "200", "10", NULL};
+	t_data		data;
+	u_int64_t	start;
+	int			out;
+
+	av[1] = n_philos;
+	memset(&data.opts, 0, sizeof(t_opts));
+	data.opts.clock = CLOCK_SRC_VIRTUAL;
+	data.opts.workers = workers;
+	if (data_init(&data, 6, av) || philo_init(&data) || fork_init(&data)
+		|| pool_init(&data) || des_init(&data))
+		exit(1);
+	out = dup(STDOUT_FILENO);
+	dup2(null_fd, STDOUT_FILENO);
+	start = bench_now_ns();
+	data.conf.start_time = get_time();
+	log_start(&data);
+	des_run(&data);
+	log_stop(&data);
+	start = bench_now_ns() - start;
+	dup2(out, STDOUT_FILENO);
+	close(out);
+	free_data(&data);
+	return (start / 1e6);
+}
+
+/*
+des_best(): Runs the same simulation DES_BENCH_RUNS times.
+
+Parameters: n_philos - The number of philosophers, as a decimal string.
+            workers - The number of workers.
+            null_fd - A descriptor of /dev/null.
+
+Return value: The best wall time, in milliseconds.
+*/
+static double	des_best(char *n_philos, int workers, int null_fd)
+{
+	double	best;
+	double	ms;
+	int		i;
+
+	best = des_once(n_philos, workers, null_fd);
+	i = 0;
+	while (++i < DES_BENCH_RUNS)
+	{
+		ms = des_once(n_philos, workers, null_fd);
+		if (ms < best)
+			best = ms;
+	}
+	return (best);
+}
+
+/*
+main(): Measures the parallel virtual-time simulation with 1 to 64
+		workers, and its speedup over a single worker.
+
+Parameters: ac - The count of command-line arguments.
+            av - An optional number of philosophers (default 100000).
+
+Return value: 0, or 1 if /dev/null cannot be opened.
+
+How it works:
+1. Reports the best wall time of DES_BENCH_RUNS runs for every power of
+	two workers up to 64, then its speedup over one worker. Past the
+	number of cores, workers only add barrier waits.
+*/
+int	main(int ac, char **av)
+{
+	char	*n_philos;
+	double	base;
+	double	best;
+	int		workers;
+	int		fd;
+
+	n_philos = "100000";
+	if (ac > 1)
+		n_philos = av[1];
+	fd = open("/dev/null", O_WRONLY);
+	if (fd < 0)
+		return (1);
+	clock_init(CLOCK_SRC_VIRTUAL);
+	base = 1;
+	printf("bench,variant,workers,value\n");
+	workers = 1;
+	while (workers <= 64)
+	{
+		best = des_best(n_philos, workers, fd);
+		if (workers == 1)
+			base = best;
+		bench_row("des_ms", n_philos, workers, best);
+		bench_row("des_speedup", n_philos, workers, base / best);
+		workers *= 2;
+	}
+	close(fd);
+	return (0);
+}
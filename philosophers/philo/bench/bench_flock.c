@@ -0,0 +1,199 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_flock.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:04:51 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:09:01 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+static char	*g_kinds[] = {"mutex", "ticket", "mcs", "adaptive", "handoff"};
+
+/*
+flock_op(): Takes or drops the fork with the lock being measured.
+
+Parameters: a - The caller: the benchmark, its MCS node and its id.
+            take - 1 to take the fork, 0 to drop it.
+
+Return value: None.
+*/
+static void	flock_op(t_flock_arg *a, int take)
+{
+	t_flock_bench	*b;
+
+	b = a->b;
+	if (b->kind == LOCK_HANDOFF && take)
+		handoff_lock(b->fork, a->id);
+	else if (b->kind == LOCK_HANDOFF)
+		handoff_unlock(b->fork);
+	else if (b->kind == LOCK_TICKET && take)
+		ticket_lock(b->fork);
+	else if (b->kind == LOCK_TICKET)
+		ticket_unlock(b->fork);
+	else if (b->kind == LOCK_MCS && take)
+		mcs_lock(b->fork, &a->node);
+	else if (b->kind == LOCK_MCS)
+		mcs_unlock(b->fork, &a->node);
+	else if (b->kind == LOCK_ADAPTIVE && take)
+		adaptive_lock(b->fork, FLOCK_BENCH_HOLD_US);
+	else if (b->kind == LOCK_ADAPTIVE)
+		adaptive_unlock(b->fork);
+	else if (take)
+		pthread_mutex_lock(&b->fork->mu);
+	else
+		pthread_mutex_unlock(&b->fork->mu);
+}
+
+/*
+flock_routine(): One of the two neighbours taking turns on the fork.
+
+Parameters: arg_p - A void pointer to the neighbour's t_flock_arg.
+
+Return value: NULL.
+
+How it works:
+1. Until the end of the run, takes the fork, counts it, and keeps the
+	longest wait. If the fork was dropped while the thread was waiting,
+	adds the time from the drop to the take to the hand-off gaps.
+2. Holds the fork FLOCK_BENCH_HOLD_US, notes the time, and drops it.
+*/
+static void	*flock_routine(void *arg_p)
+{
+	t_flock_arg	*a;
+	u_int64_t	start;
+	u_int64_t	now;
+
+	a = arg_p;
+	while (bench_now_ns() < a->b->end_ns)
+	{
+		start = bench_now_ns();
+		flock_op(a, 1);
+		now = bench_now_ns();
+		if (atomic_load(&a->b->released) > start && ++a->n_gaps)
+			a->gap_ns += now - atomic_load(&a->b->released);
+		if (now - start > a->wait_max_ns)
+			a->wait_max_ns = now - start;
+		a->n++;
+		while (bench_now_ns() < now + FLOCK_BENCH_HOLD_US * 1000)
+			;
+		atomic_store(&a->b->released, bench_now_ns());
+		flock_op(a, 0);
+	}
+	return (NULL);
+}
+
+/*
+flock_print(): Prints the measurements of a contended run.
+
+Parameters: b - The benchmark.
+            a - The two neighbours, after they have joined.
+
+Return value: None.
+
+How it works:
+1. Prints the average hand-off gap, the longest wait, the number of turns
+	taken, and Jain's fairness index of the two neighbours' turns: 1 when
+	they alternate, 0.5 when one of them keeps the fork.
+*/
+static void	flock_print(t_flock_bench *b, t_flock_arg *a)
+{
+	double		turns;
+	double		sq;
+	u_int64_t	n_gaps;
+	u_int64_t	max;
+
+	turns = (double)a[0].n + a[1].n;
+	sq = (double)a[0].n * a[0].n + (double)a[1].n * a[1].n;
+	n_gaps = a[0].n_gaps + a[1].n_gaps;
+	if (n_gaps == 0)
+		n_gaps = 1;
+	max = a[0].wait_max_ns;
+	if (a[1].wait_max_ns > max)
+		max = a[1].wait_max_ns;
+	bench_row("flock_handoff_ns", g_kinds[b->kind], FLOCK_BENCH_HOLD_US,
+		(double)(a[0].gap_ns + a[1].gap_ns) / n_gaps);
+	bench_row("flock_wait_max_us", g_kinds[b->kind], FLOCK_BENCH_HOLD_US,
+		max / 1000.0);
+	bench_row("flock_turns", g_kinds[b->kind], FLOCK_BENCH_HOLD_US, turns);
+	if (sq == 0)
+		sq = 1;
+	bench_row("flock_jain", g_kinds[b->kind], FLOCK_BENCH_HOLD_US,
+		turns * turns / (2 * sq));
+}
+
+/*
+bench_lock(): Measures one lock.
+
+Parameters: b - The benchmark, with the lock to measure and a free fork.
+
+Return value: None.
+
+How it works:
+1. Times FLOCK_BENCH_ITERS uncontended takes and drops of the fork, by
+	the first of the two neighbours.
+2. Runs two flock_routine() threads for FLOCK_BENCH_MS, then prints what
+	they measured with flock_print().
+*/
+static void	bench_lock(t_flock_bench *b)
+{
+	t_flock_arg	a[2];
+	pthread_t	th[2];
+	u_int64_t	start;
+	int			i;
+
+	memset(a, 0, sizeof(a));
+	a[0].b = b;
+	a[0].id = 1;
+	a[1].b = b;
+	a[1].id = 2;
+	start = bench_now_ns();
+	i = -1;
+	while (++i < FLOCK_BENCH_ITERS)
+	{
+		flock_op(&a[0], 1);
+		flock_op(&a[0], 0);
+	}
+	bench_row("flock_uncontended_ns", g_kinds[b->kind], FLOCK_BENCH_ITERS,
+		(double)(bench_now_ns() - start) / FLOCK_BENCH_ITERS);
+	b->end_ns = bench_now_ns() + FLOCK_BENCH_MS * 1000000ULL;
+	pthread_create(&th[0], NULL, &flock_routine, &a[0]);
+	pthread_create(&th[1], NULL, &flock_routine, &a[1]);
+	pthread_join(th[0], NULL);
+	pthread_join(th[1], NULL);
+	flock_print(b, a);
+}
+
+/*
+main(): Compares the --fork-lock locks.
+
+Parameters: None.
+
+Return value: 0.
+
+How it works:
+1. Measures each lock on a fresh fork with bench_lock().
+*/
+int	main(void)
+{
+	t_fork			fork;
+	t_flock_bench	b;
+
+	printf("bench,variant,param,value\n");
+	b.fork = &fork;
+	b.kind = LOCK_MUTEX;
+	while (b.kind <= LOCK_HANDOFF)
+	{
+		memset(&fork, 0, sizeof(t_fork));
+		pthread_mutex_init(&fork.mu, NULL);
+		atomic_store(&b.released, 0);
+		bench_lock(&b);
+		pthread_mutex_destroy(&fork.mu);
+		b.kind++;
+	}
+	return (0);
+}
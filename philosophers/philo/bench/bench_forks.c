@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_forks.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:19:28 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:19:28 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/*
+forks_worker(): Takes and drops a philosopher's forks n_cycles times.
+
+Parameters: arg_p - A void pointer to the worker's t_bench_arg.
+
+Return value: NULL.
+*/
+static void	*forks_worker(void *arg_p)
+{
+	t_bench_arg	*arg;
+	t_philo		*philo;
+	int			i;
+
+	arg = (t_bench_arg *)arg_p;
+	philo = &arg->bench->data->philo[arg->i];
+	i = -1;
+	while (++i < arg->bench->n_cycles)
+	{
+		take_both(philo);
+		drop_both(philo);
+	}
+	return (NULL);
+}
+
+/*
+forks_run(): Measures take_both() and drop_both() on a table.
+
+Parameters: n_philos - The number of philosophers, as a decimal string.
+            n_threads - How many of them take their forks, from the first.
+            variant - The name of the variant, for the report.
+
+Return value: None.
+
+How it works:
+1. Sets the table up as philo() does, with the default --forks strategy.
+2. Runs a thread per philosopher taking part, which take and drop their
+	forks FORKS_BENCH_PAIRS times in all, and reports the wall time per
+	take and drop of one philosopher. With all of them at it, that
+	includes the waits for the neighbours.
+*/
+static void	forks_run(char *n_philos, int n_threads, char *variant)
+{
+	t_data		data;
+	t_bench		bench;
+	t_bench_arg	*arg;
+	u_int64_t	ns;
+	int			i;
+
+	bench_data(&data, n_philos, LAYOUT_PADDED);
+	if (strategy_init(&data))
+		exit(1);
+	bench.data = &data;
+	bench.n_cycles = FORKS_BENCH_PAIRS / n_threads;
+	arg = bench_args(&bench);
+	ns = bench_now_ns();
+	i = -1;
+	while (++i < n_threads)
+		pthread_create(&data.philo_th[i], NULL, &forks_worker, &arg[i]);
+	while (--i >= 0)
+		pthread_join(data.philo_th[i], NULL);
+	ns = bench_now_ns() - ns;
+	bench_row("forks_pair_ns", variant, n_threads,
+		(double)ns / bench.n_cycles);
+	free(arg);
+	free_data(&data);
+}
+
+/*
+main(): Measures the fork primitives uncontended and contended.
+
+Parameters: None.
+
+Return value: 0.
+
+How it works:
+1. Uncontended: philosopher 1 alone takes its forks, its neighbours idle.
+2. Contended: every philosopher of a table of 2, 5 and 200 takes its
+	forks at once. No thread is bound to a log ring, so the fork messages
+	are dropped and only the forks are timed.
+*/
+int	main(void)
+{
+	printf("bench,variant,threads,value\n");
+	forks_run("200", 1, "uncontended");
+	forks_run("2", 2, "contended");
+	forks_run("5", 5, "contended");
+	forks_run("200", 200, "contended");
+	return (0);
+}
@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_format.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:06:01 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 02:06:01 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/*
+snprintf_format(): The line formatting of the first log writer: snprintf
+					for the "ms id " prefix, then the message and its
+					strlen.
+
+Parameters: dst - Where to write the line.
+            ms - The timestamp, in milliseconds.
+            id - The id of the philosopher.
+            msg - The message.
+
+Return value: The length of the line.
+*/
+static size_t	snprintf_format(char *dst, u_int64_t ms, int id, t_msg msg)
+{
+	static const char	*msgs[] = {"has taken a fork\n", "is eating\n",
+		"is sleeping\n", "is thinking\n", "died\n"};
+	size_t				len;
+
+	len = snprintf(dst, LOG_LINE_MAX, "%llu %d ", (unsigned long long)ms, id);
+	memcpy(dst + len, msgs[msg], strlen(msgs[msg]));
+	return (len + strlen(msgs[msg]));
+}
+
+/*
+run_batched(): Formats n lines into a LOG_BUF_SIZE buffer flushed with one
+				write each time it fills up, as the log writer does, and
+				reports lines per second.
+
+Parameters: fd - The file descriptor to write to.
+            variant - The name of the variant, for the report.
+            fmt - The line formatter.
+            n - The number of lines.
+
+Return value: None.
+*/
+static void	run_batched(int fd, char *variant, t_fmt fmt, int n)
+{
+	static char	buf[LOG_BUF_SIZE];
+	size_t		len;
+	u_int64_t	start;
+	int			i;
+
+	len = 0;
+	start = bench_now_ns();
+	i = -1;
+	while (++i < n)
+	{
+		if (len + LOG_LINE_MAX > LOG_BUF_SIZE)
+		{
+			if (write(fd, buf, len) < 0)
+				return ;
+			len = 0;
+		}
+		len += fmt(buf + len, i / 8, i % 200 + 1, (t_msg)(i % 5));
+	}
+	if (write(fd, buf, len) < 0)
+		return ;
+	bench_row("format_lines_per_sec", variant, n,
+		n / ((bench_now_ns() - start) / 1e9));
+}
+
+/*
+run_printf(): Prints n lines as print_changestate() did before the log
+				writer: print mutex, then printf("%llu %d %s\n").
+
+Parameters: variant - The name of the variant, for the report.
+            mode - The stdio buffering mode: _IOLBF, as on a terminal, or
+				_IOFBF, as when stdout is a pipe or a file.
+            n - The number of lines.
+
+Return value: None.
+*/
+static void	run_printf(char *variant, int mode, int n)
+{
+	static const char	*msgs[] = {"has taken a fork", "is eating",
+		"is sleeping", "is thinking", "died"};
+	pthread_mutex_t		mu;
+	FILE				*out;
+	u_int64_t			start;
+	int					i;
+
+	out = fopen("/dev/null", "w");
+	setvbuf(out, NULL, mode, BUFSIZ);
+	pthread_mutex_init(&mu, NULL);
+	start = bench_now_ns();
+	i = -1;
+	while (++i < n)
+	{
+		pthread_mutex_lock(&mu);
+		fprintf(out, "%llu %d %s\n", (unsigned long long)i / 8,
+			i % 200 + 1, msgs[i % 5]);
+		pthread_mutex_unlock(&mu);
+	}
+	fclose(out);
+	bench_row("format_lines_per_sec", variant, n,
+		n / ((bench_now_ns() - start) / 1e9));
+	pthread_mutex_destroy(&mu);
+}
+
+/*
+main(): Measures log lines per second written to /dev/null by the old
+		locked printf path, line and fully buffered, by snprintf into a
+		batch buffer, and by log_format() into a batch buffer.
+
+Return value: 0, or 1 if /dev/null cannot be opened.
+*/
+int	main(void)
+{
+	int	fd;
+	int	n;
+
+	fd = open("/dev/null", O_WRONLY);
+	if (fd < 0)
+		return (1);
+	printf("bench,variant,lines,value\n");
+	n = 2000000;
+	run_printf("printf_line", _IOLBF, n);
+	run_printf("printf_full", _IOFBF, n);
+	run_batched(fd, "snprintf", &snprintf_format, n);
+	run_batched(fd, "log_format", &log_format, n);
+	close(fd);
+	return (0);
+}
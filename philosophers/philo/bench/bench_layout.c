@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_layout.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:46:06 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 01:46:06 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/*
+layout_worker(): Eats n_cycles meals as fast as possible: both forks are
+				locked in take_both() order and the hot data is updated as
+				in eat().
+
+Parameters: arg_p - A void pointer to the worker's t_bench_arg.
+
+Return value: NULL.
+*/
+static void	*layout_worker(void *arg_p)
+{
+	t_bench_arg	*arg;
+	t_philo		*philo;
+	int			i;
+
+	arg = (t_bench_arg *)arg_p;
+	philo = &arg->bench->data->philo[arg->i];
+	i = -1;
+	while (++i < arg->bench->n_cycles)
+	{
+		pthread_mutex_lock(&philo->right_f->mu);
+		pthread_mutex_lock(&philo->left_f->mu);
+		push_philo_state(philo, EATING);
+		update_last_meal(philo);
+		update_n_meals(philo);
+		push_philo_state(philo, SLEEPING);
+		pthread_mutex_unlock(&philo->left_f->mu);
+		pthread_mutex_unlock(&philo->right_f->mu);
+	}
+	return (NULL);
+}
+
+/*
+layout_monitor(): Polls every philosopher's hot data without sleeping.
+
+Parameters: bench_p - A void pointer to the benchmark structure.
+
+Return value: NULL.
+*/
+static void	*layout_monitor(void *bench_p)
+{
+	t_bench	*bench;
+	int		i;
+
+	bench = (t_bench *)bench_p;
+	while (atomic_load(&bench->running))
+	{
+		i = -1;
+		while (++i < bench->data->conf.n_philos)
+		{
+			philo_death(&bench->data->philo[i]);
+			pull_n_meals_had(&bench->data->philo[i]);
+		}
+	}
+	return (NULL);
+}
+
+/*
+run_layout(): Runs one philosopher thread per seat plus a monitor and
+				reports meals per second and cache misses.
+
+Parameters: bench - A pointer to the benchmark structure.
+            arg - An array of one t_bench_arg per philosopher.
+            variant - The name of the layout, for the report.
+
+Return value: None.
+*/
+static void	run_layout(t_bench *bench, t_bench_arg *arg, char *variant)
+{
+	pthread_t	monit;
+	u_int64_t	start;
+	int			fd;
+	int			i;
+
+	fd = bench_perf_open();
+	atomic_store(&bench->running, 1);
+	pthread_create(&monit, NULL, &layout_monitor, bench);
+	start = bench_now_ns();
+	i = -1;
+	while (++i < bench->data->conf.n_philos)
+		pthread_create(&bench->data->philo_th[i], NULL, &layout_worker,
+			&arg[i]);
+	while (--i >= 0)
+		pthread_join(bench->data->philo_th[i], NULL);
+	bench_row("layout_meals_per_sec", variant, bench->data->conf.n_philos,
+		1e9 * bench->n_cycles * bench->data->conf.n_philos
+		/ (bench_now_ns() - start));
+	atomic_store(&bench->running, 0);
+	pthread_join(monit, NULL);
+	bench_row("layout_cache_misses", variant, bench->data->conf.n_philos,
+		bench_perf_close(fd));
+}
+
+/*
+main(): Compares the padded and the packed layouts of the hot philosopher
+		data and the forks for 200 to 2000 philosophers. Cache misses are
+		-1 when the kernel does not expose the hardware counters.
+
+Return value: 0.
+*/
+int	main(void)
+{
+	static char	*sizes[] = {"200", "500", "1000", "2000", NULL};
+	t_bench		bench;
+	t_data		data;
+	t_bench_arg	*arg;
+	int			i;
+
+	printf("bench,variant,philos,value\n");
+	i = -1;
+	while (sizes[++i])
+	{
+		bench_data(&data, sizes[i], LAYOUT_PADDED);
+		bench.data = &data;
+		bench.n_cycles = 2000000 / data.conf.n_philos;
+		arg = bench_args(&bench);
+		run_layout(&bench, arg, "padded");
+		free_data(&data);
+		bench_data(&data, sizes[i], LAYOUT_PACKED);
+		run_layout(&bench, arg, "packed");
+		free_data(&data);
+		free(arg);
+	}
+	return (0);
+}
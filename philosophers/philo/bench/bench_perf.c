@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_perf.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:46:22 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 01:46:22 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+#include <linux/perf_event.h> //struct perf_event_attr
+#include <sys/syscall.h> //syscall(): perf_event_open has no libc wrapper
+
+/*
+bench_perf_open(): Opens a cache-miss counter for this thread and every
+					thread it creates afterwards.
+
+Parameters: None.
+
+Return value: The counter's file descriptor, or -1 if the kernel does not
+				allow it (e.g. perf_event_paranoid, containers).
+*/
+int	bench_perf_open(void)
+{
+	struct perf_event_attr	attr;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.config = PERF_COUNT_HW_CACHE_MISSES;
+	attr.inherit = 1;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	return ((int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+/*
+bench_perf_close(): Reads and closes a counter opened by bench_perf_open.
+
+Parameters: fd - The counter's file descriptor, or -1.
+
+Return value: The counter's value, or -1 if it could not be read.
+
+How it works:
+1. Reads the counter once every thread that inherited it has been joined,
+	so their counts are included.
+*/
+long long	bench_perf_close(int fd)
+{
+	long long	count;
+
+	if (fd < 0)
+		return (-1);
+	if (read(fd, &count, sizeof(count)) != sizeof(count))
+		count = -1;
+	close(fd);
+	return (count);
+}
@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_prims.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:18:51 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:18:51 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+static volatile u_int64_t	g_sink;
+
+/*
+prims_clock(): Times get_time() on one clock source.
+
+Parameters: src - The clock source.
+            variant - The name of the source, for the report.
+
+Return value: None.
+
+How it works:
+1. Selects the source with clock_init(). If it is not available, as the
+	TSC on some hosts, reports nothing.
+2. Calls get_time() PRIMS_BENCH_CALLS times and reports the nanoseconds
+	per call. Their sum goes to g_sink, so the calls are not optimized
+	away.
+*/
+static void	prims_clock(t_clock_src src, char *variant)
+{
+	u_int64_t	start;
+	u_int64_t	sum;
+	int			i;
+
+	if (clock_init(src))
+		return ;
+	sum = 0;
+	start = bench_now_ns();
+	i = -1;
+	while (++i < PRIMS_BENCH_CALLS)
+		sum += get_time();
+	start = bench_now_ns() - start;
+	g_sink = sum;
+	bench_row("get_time_ns", variant, PRIMS_BENCH_CALLS,
+		(double)start / PRIMS_BENCH_CALLS);
+}
+
+/*
+prims_call(): Calls one accessor.
+
+Parameters: philo - A pointer to the philosopher structure.
+            kind - The index of the accessor in the names of
+				prims_accessors().
+
+Return value: The value read, or 0 for a write, for the caller to sum.
+*/
+static u_int64_t	prims_call(t_philo *philo, int kind)
+{
+	if (kind == 0)
+		return (pull_philo_state(philo));
+	if (kind == 1)
+		return (pull_last_meal(philo));
+	if (kind == 2)
+		return (pull_n_meals_had(philo));
+	if (kind == 3)
+		return (pull_keep_iter(philo->data));
+	if (kind == 4)
+		push_philo_state(philo, THINKING);
+	if (kind == 5)
+		update_last_meal(philo);
+	if (kind == 6)
+		update_n_meals(philo);
+	return (0);
+}
+
+/*
+prims_accessors(): Times every accessor, uncontended.
+
+Parameters: philo - A pointer to the philosopher to read and write.
+
+Return value: None.
+
+How it works:
+1. Calls each accessor PRIMS_BENCH_CALLS times in a row, through
+	prims_call(), and reports the nanoseconds per call, the dispatch
+	included.
+*/
+static void	prims_accessors(t_philo *philo)
+{
+	static char	*names[] = {"pull_philo_state", "pull_last_meal",
+		"pull_n_meals_had", "pull_keep_iter", "push_philo_state",
+		"update_last_meal", "update_n_meals", NULL};
+	u_int64_t	start;
+	int			kind;
+	int			i;
+
+	kind = -1;
+	while (names[++kind])
+	{
+		start = bench_now_ns();
+		i = -1;
+		while (++i < PRIMS_BENCH_CALLS)
+			g_sink += prims_call(philo, kind);
+		start = bench_now_ns() - start;
+		bench_row("accessor_ns", names[kind], PRIMS_BENCH_CALLS,
+			(double)start / PRIMS_BENCH_CALLS);
+	}
+}
+
+/*
+main(): Measures the primitives every state change pays for: reading the
+		clock and the philosopher state accessors.
+
+Parameters: None.
+
+Return value: 0.
+
+How it works:
+1. Times get_time() on CLOCK_MONOTONIC and on the TSC.
+2. Times the accessors on philosopher 1 of a table of 5, on the monotonic
+	clock, as update_last_meal() reads it.
+*/
+int	main(void)
+{
+	t_data	data;
+
+	printf("bench,variant,calls,value\n");
+	prims_clock(CLOCK_SRC_MONO, "mono");
+	prims_clock(CLOCK_SRC_TSC, "tsc");
+	clock_init(CLOCK_SRC_MONO);
+	bench_data(&data, "5", LAYOUT_PADDED);
+	prims_accessors(&data.philo[0]);
+	free_data(&data);
+	return (0);
+}
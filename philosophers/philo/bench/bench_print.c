@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_print.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:19:10 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:19:10 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/*
+print_worker(): Logs n_cycles state changes of one philosopher.
+
+Parameters: arg_p - A void pointer to the worker's t_bench_arg.
+
+Return value: NULL.
+
+How it works:
+1. Binds the thread to the philosopher's log ring, as routine() does.
+2. Pushes the messages of a meal in turn through print_changestate().
+*/
+static void	*print_worker(void *arg_p)
+{
+	t_bench_arg	*arg;
+	int			i;
+
+	arg = (t_bench_arg *)arg_p;
+	log_attach(arg->bench->data, arg->i);
+	i = -1;
+	while (++i < arg->bench->n_cycles)
+		print_changestate(arg->bench->data, arg->i + 1, (t_msg)(i % 4));
+	return (NULL);
+}
+
+/*
+print_threads(): Runs one writer thread per philosopher and the log writer
+					until every event is written.
+
+Parameters: bench - A pointer to the benchmark structure.
+
+Return value: The wall time from the start of the log writer until it
+				flushed the last event, in nanoseconds.
+*/
+static u_int64_t	print_threads(t_bench *bench)
+{
+	t_data		*data;
+	t_bench_arg	*arg;
+	u_int64_t	start;
+	int			i;
+
+	data = bench->data;
+	arg = bench_args(bench);
+	start = bench_now_ns();
+	log_start(data);
+	i = -1;
+	while (++i < data->conf.n_philos)
+		pthread_create(&data->philo_th[i], NULL, &print_worker, &arg[i]);
+	while (--i >= 0)
+		pthread_join(data->philo_th[i], NULL);
+	log_stop(data);
+	start = bench_now_ns() - start;
+	free(arg);
+	return (start);
+}
+
+/*
+print_run(): Measures the log throughput with a number of writers.
+
+Parameters: n_writers - The number of writer threads, as a decimal string.
+            null_fd - A descriptor of /dev/null, where the log goes.
+
+Return value: None.
+
+How it works:
+1. Sets a table up with one philosopher per writer, each to push its
+	share of PRINT_BENCH_EVENTS.
+2. Points stdout to /dev/null while the writers run, so the log writer
+	does not time the terminal, and reports the events per second.
+*/
+static void	print_run(char *n_writers, int null_fd)
+{
+	t_data		data;
+	t_bench		bench;
+	u_int64_t	ns;
+	int			out;
+
+	bench_data(&data, n_writers, LAYOUT_PADDED);
+	bench.data = &data;
+	bench.n_cycles = PRINT_BENCH_EVENTS / data.conf.n_philos;
+	out = dup(STDOUT_FILENO);
+	dup2(null_fd, STDOUT_FILENO);
+	ns = print_threads(&bench);
+	dup2(out, STDOUT_FILENO);
+	close(out);
+	bench_row("print_events_per_s", "print_changestate", data.conf.n_philos,
+		(double)bench.n_cycles * data.conf.n_philos / (ns / 1e9));
+	free_data(&data);
+}
+
+/*
+main(): Measures print_changestate() with 1 to 200 concurrent writers.
+
+Parameters: None.
+
+Return value: 0, or 1 if /dev/null cannot be opened.
+*/
+int	main(void)
+{
+	static char	*writers[] = {"1", "2", "5", "20", "50", "200", NULL};
+	int			null_fd;
+	int			i;
+
+	null_fd = open("/dev/null", O_WRONLY);
+	if (null_fd < 0)
+		return (1);
+	printf("bench,variant,writers,value\n");
+	i = -1;
+	while (writers[++i])
+		print_run(writers[i], null_fd);
+	close(null_fd);
+	return (0);
+}
@@ -0,0 +1,204 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_proc.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:15:02 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:15:02 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/*
+proc_run(): Runs one simulation through philo(), recording its trace.
+
+Parameters: ac - The count of arguments.
+            av - The arguments, as the command line gives them.
+            processes - 1 to run with --processes, 0 with threads.
+
+Return value: None.
+
+How it works:
+1. Sets the default options, with the trace in PROC_BENCH_TRACE.
+2. Points stdout to /dev/null while the simulation runs, in case
+	anything is printed besides the trace.
+*/
+static void	proc_run(int ac, char **av, int processes)
+{
+	t_opts	opts;
+	int		null_fd;
+	int		out;
+
+	memset(&opts, 0, sizeof(t_opts));
+	opts.layout = LAYOUT_PADDED;
+	opts.clock = CLOCK_SRC_MONO;
+	opts.trace = PROC_BENCH_TRACE;
+	opts.processes = processes;
+	null_fd = open("/dev/null", O_WRONLY);
+	out = dup(STDOUT_FILENO);
+	dup2(null_fd, STDOUT_FILENO);
+	if (philo(ac, av, &opts))
+		exit(1);
+	dup2(out, STDOUT_FILENO);
+	close(out);
+	close(null_fd);
+}
+
+/*
+proc_event(): Accounts for one record of the trace.
+
+Parameters: b - A pointer to the benchmark.
+            ts - The time of the record since the start, in microseconds.
+            id - The id of the philosopher.
+            msg - The message.
+
+Return value: None.
+
+How it works:
+1. The first meal of an odd philosopher pushes the start-up time.
+2. "is thinking" marks the philosopher as waiting for its forks, and a
+	neighbour's "is sleeping" as freed from then on. Its next fork ends
+	the hand-off, and its meal ends the wait.
+3. "died" adds the time since the deadline to the deaths.
+*/
+static void	proc_event(t_proc_bench *b, u_int64_t ts, int id, t_msg msg)
+{
+	if (msg == MSG_EAT && id % 2 && !b->seat[id].ate && ts > b->start_us)
+		b->start_us = ts;
+	if (msg == MSG_THINK)
+		b->seat[id].think = ts;
+	if (msg == MSG_EAT)
+		b->seat[id].ate = ts;
+	if (msg == MSG_EAT || msg == MSG_THINK)
+		b->seat[id].freed = 0;
+	if (msg == MSG_EAT)
+		b->seat[id].think = 0;
+	if (msg == MSG_SLEEP && b->seat[id % b->n + 1].think)
+		b->seat[id % b->n + 1].freed = ts;
+	if (msg == MSG_SLEEP && b->seat[(id + b->n - 2) % b->n + 1].think)
+		b->seat[(id + b->n - 2) % b->n + 1].freed = ts;
+	if (msg == MSG_FORK && b->seat[id].freed)
+	{
+		b->gap_us += ts - b->seat[id].freed;
+		b->n_gaps++;
+		b->seat[id].freed = 0;
+	}
+	if (msg == MSG_DIED)
+		b->death_us += (long)ts - (long)(b->seat[id].ate + b->todie_us);
+}
+
+/*
+proc_scan(): Reads the trace of the last run back.
+
+Parameters: b - A pointer to the benchmark.
+
+Return value: None.
+
+How it works:
+1. Maps the trace file, and gives the run fresh seats.
+2. Adds the deltas up into timestamps and hands every record but the
+	TRACE_GAP ones to proc_event().
+*/
+static void	proc_scan(t_proc_bench *b)
+{
+	t_trace_hdr	*hdr;
+	t_trace_rec	*rec;
+	u_int64_t	ts;
+	u_int64_t	i;
+	int			fd;
+
+	fd = open(PROC_BENCH_TRACE, O_RDONLY);
+	hdr = mmap(NULL, lseek(fd, 0, SEEK_END), PROT_READ, MAP_PRIVATE, fd, 0);
+	b->seat = calloc(b->n + 1, sizeof(t_proc_seat));
+	if (fd < 0 || hdr == MAP_FAILED || !b->seat)
+		exit(1);
+	rec = (t_trace_rec *)(hdr + 1);
+	ts = 0;
+	i = 0;
+	while (i < hdr->n_recs)
+	{
+		ts += rec[i].delta;
+		if (rec[i].id_msg != TRACE_GAP)
+			proc_event(b, ts, rec[i].id_msg >> 8, rec[i].id_msg & 0xFF);
+		i++;
+	}
+	munmap(hdr, sizeof(t_trace_hdr) + hdr->n_recs * sizeof(t_trace_rec));
+	close(fd);
+	free(b->seat);
+}
+
+/*
+proc_bench(): Benchmarks one table size in one mode.
+
+Parameters: variant - The name of the mode in the CSV rows.
+            processes - 1 to run with --processes, 0 with threads.
+            n - The number of philosophers, even, as a decimal string.
+
+Return value: None.
+
+How it works:
+1. Runs n 1000 200 100 3, where the odd philosophers always wait for the
+	even ones, and the other way round, and prints the start-up and
+	hand-off times.
+2. Runs n 310 200 100 PROC_BENCH_DEATHS times, where the first odd
+	philosopher to wait dies, and prints the average time to report it.
+*/
+static void	proc_bench(char *variant, int processes, char *n)
+{
+	static char		*meals[] = {"bench", NULL, "1000", "200", "100", "3",
+		NULL};
+	static char		*death[] = {"bench", NULL, "310", "200", "100", NULL};
+	t_proc_bench	b;
+	int				i;
+
+	memset(&b, 0, sizeof(t_proc_bench));
+	b.n = atoi(n);
+	meals[1] = n;
+	death[1] = n;
+	b.todie_us = 1000000;
+	proc_run(6, meals, processes);
+	proc_scan(&b);
+	bench_row("proc_startup_us", variant, b.n, b.start_us);
+	bench_row("proc_handoff_us", variant, b.n, b.gap_us / (double)b.n_gaps);
+	b.todie_us = 310000;
+	i = -1;
+	while (++i < PROC_BENCH_DEATHS)
+	{
+		proc_run(5, death, processes);
+		proc_scan(&b);
+	}
+	bench_row("proc_death_us", variant, b.n,
+		b.death_us / (double)PROC_BENCH_DEATHS);
+}
+
+/*
+main(): Compares --processes with threads on tables of 10 and 100.
+
+Parameters: None.
+
+Return value: 0.
+
+How it works:
+1. Sets the clock and ft_usleep up as the simulation's main() does.
+2. Runs proc_bench() in both modes for each size, then removes the trace.
+*/
+int	main(void)
+{
+	static char	*sizes[] = {"10", "100", NULL};
+	int			i;
+
+	clock_init(CLOCK_SRC_MONO);
+	sleep_init(0, 0);
+	printf("bench,variant,param,value\n");
+	i = -1;
+	while (sizes[++i])
+	{
+		proc_bench("threads", 0, sizes[i]);
+		proc_bench("processes", 1, sizes[i]);
+	}
+	unlink(PROC_BENCH_TRACE);
+	return (0);
+}
@@ -0,0 +1,169 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_sleep.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:49:36 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:24:52 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/*
+legacy_usleep(): The ft_usleep() loop this project used before the hybrid
+					sleep: poll the clock every 500 us.
+
+Parameters: sleep_time - The amount of time to sleep in microseconds.
+
+Return value: How late the call returned, in nanoseconds.
+*/
+static u_int64_t	legacy_usleep(u_int64_t sleep_time)
+{
+	u_int64_t	deadline;
+	u_int64_t	now;
+
+	deadline = clock_ns() + sleep_time * 1000;
+	now = clock_ns();
+	while (now < deadline)
+	{
+		usleep(500);
+		now = clock_ns();
+	}
+	return (now - deadline);
+}
+
+/*
+sleep_worker(): Sleeps n_sleeps times and records every overshoot.
+
+Parameters: sb_p - A void pointer to the t_sleep_bench of the run.
+
+Return value: NULL.
+
+How it works:
+1. Adds each overshoot to the average and maximum, and keeps it among the
+	samples for the percentiles.
+*/
+static void	*sleep_worker(void *sb_p)
+{
+	t_sleep_bench	*sb;
+	u_int64_t		over;
+	int				i;
+
+	sb = (t_sleep_bench *)sb_p;
+	i = -1;
+	while (++i < sb->n_sleeps)
+	{
+		if (sb->legacy)
+			over = legacy_usleep(sb->us);
+		else
+		{
+			over = clock_ns();
+			ft_usleep(sb->us);
+			over = clock_ns() - over - sb->us * 1000;
+		}
+		sleep_record(&sb->stats, over);
+		sb->samples[atomic_fetch_add(&sb->n_samples, 1)] = over;
+	}
+	return (NULL);
+}
+
+/*
+sleep_dist(): Reports the distribution of the overshoots of a run.
+
+Parameters: sb - A pointer to the t_sleep_bench of the run.
+            variant - The name of the variant, for the report.
+
+Return value: None.
+
+How it works:
+1. Sorts the samples and prints their median, 90th and 99th percentiles.
+*/
+static void	sleep_dist(t_sleep_bench *sb, char *variant)
+{
+	u_int64_t	n;
+
+	n = atomic_load(&sb->n_samples);
+	bench_sort(sb->samples, n);
+	bench_row("sleep_over_p50_us", variant, sb->us,
+		bench_pct(sb->samples, n, 50) / 1000.0);
+	bench_row("sleep_over_p90_us", variant, sb->us,
+		bench_pct(sb->samples, n, 90) / 1000.0);
+	bench_row("sleep_over_p99_us", variant, sb->us,
+		bench_pct(sb->samples, n, 99) / 1000.0);
+}
+
+/*
+run_sleep(): Runs n_threads sleepers and reports overshoot and CPU time.
+
+Parameters: sb - A pointer to the t_sleep_bench of the run.
+            n_threads - The number of concurrent sleepers.
+            variant - The name of the variant, for the report.
+
+Return value: None.
+
+How it works:
+1. Measures the process CPU time (user and system) across the run.
+2. Reports the average and maximum overshoot, their distribution with
+	sleep_dist(), and the CPU time spent per second of requested sleep.
+*/
+static void	run_sleep(t_sleep_bench *sb, int n_threads, char *variant)
+{
+	pthread_t	th[200];
+	u_int64_t	cpu;
+	u_int64_t	n;
+	int			i;
+
+	memset(&sb->stats, 0, sizeof(t_sleep));
+	atomic_store(&sb->n_samples, 0);
+	cpu = bench_cpu_ns();
+	i = -1;
+	while (++i < n_threads)
+		pthread_create(&th[i], NULL, &sleep_worker, sb);
+	while (--i >= 0)
+		pthread_join(th[i], NULL);
+	cpu = bench_cpu_ns() - cpu;
+	n = atomic_load(&sb->stats.n_sleeps);
+	bench_row("sleep_over_avg_us", variant, sb->us,
+		atomic_load(&sb->stats.total_ns) / 1000.0 / n);
+	bench_row("sleep_over_max_us", variant, sb->us,
+		atomic_load(&sb->stats.max_ns) / 1000.0);
+	bench_row("sleep_cpu_ms_per_s", variant, sb->us,
+		cpu / 1000.0 / ((double)n * sb->us / 1000000.0) / 1000.0);
+	sleep_dist(sb, variant);
+}
+
+/*
+main(): Compares the legacy 500 us polling loop with the hybrid
+		clock_nanosleep + yield ft_usleep(), for 200 concurrent sleepers
+		and requested durations from 1 ms to 200 ms: the average, the
+		maximum and the percentiles of the overshoot.
+
+Return value: 0.
+*/
+int	main(void)
+{
+	static u_int64_t	durations[] = {1000, 10000, 60000, 200000, 0};
+	t_sleep_bench		sb;
+	int					i;
+
+	sleep_init(0, 0);
+	printf("bench,variant,requested_us,value\n");
+	i = -1;
+	while (durations[++i])
+	{
+		sb.us = durations[i];
+		sb.n_sleeps = 200000 / durations[i] + 2;
+		sb.samples = malloc(sizeof(u_int64_t) * 200 * sb.n_sleeps);
+		if (!sb.samples)
+			return (1);
+		sb.legacy = 1;
+		run_sleep(&sb, 200, "legacy");
+		sb.legacy = 0;
+		run_sleep(&sb, 200, "hybrid");
+		free(sb.samples);
+	}
+	return (0);
+}
@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_stats.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:18:16 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:18:16 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/*
+cmp_u64(): Orders two u_int64_t for qsort().
+
+Parameters: a - A pointer to the first value.
+            b - A pointer to the second value.
+
+Return value: Negative, zero or positive as a is less than, equal to or
+				greater than b.
+*/
+static int	cmp_u64(const void *a, const void *b)
+{
+	u_int64_t	x;
+	u_int64_t	y;
+
+	x = *(const u_int64_t *)a;
+	y = *(const u_int64_t *)b;
+	return ((x > y) - (x < y));
+}
+
+/*
+bench_sort(): Sorts samples in ascending order, for bench_pct().
+
+Parameters: v - The samples.
+            n - The number of samples.
+
+Return value: None.
+*/
+void	bench_sort(u_int64_t *v, size_t n)
+{
+	qsort(v, n, sizeof(u_int64_t), &cmp_u64);
+}
+
+/*
+bench_pct(): Returns a percentile of sorted samples.
+
+Parameters: v - The samples, sorted by bench_sort().
+            n - The number of samples.
+            pct - The percentile, from 0 to 100.
+
+Return value: The sample below which pct percent of them fall, by the
+				nearest-rank method, or 0 if there are none.
+*/
+u_int64_t	bench_pct(u_int64_t *v, size_t n, double pct)
+{
+	size_t	rank;
+
+	if (n == 0)
+		return (0);
+	rank = (size_t)(pct / 100.0 * n);
+	if (rank < pct / 100.0 * n)
+		rank++;
+	if (rank < 1)
+		rank = 1;
+	if (rank > n)
+		rank = n;
+	return (v[rank - 1]);
+}
@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_utils.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:42:38 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 01:49:49 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/*
+bench_now_ns(): Returns a monotonic timestamp in nanoseconds.
+
+Parameters: None.
+
+Return value: The current CLOCK_MONOTONIC time in nanoseconds.
+*/
+u_int64_t	bench_now_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((u_int64_t)ts.tv_sec * 1000000000ULL + (u_int64_t)ts.tv_nsec);
+}
+
+/*
+bench_cpu_ns(): Returns the CPU time consumed by the whole process.
+
+Parameters: None.
+
+Return value: The user and system CPU time of all threads, in nanoseconds.
+*/
+u_int64_t	bench_cpu_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+	return ((u_int64_t)ts.tv_sec * 1000000000ULL + (u_int64_t)ts.tv_nsec);
+}
+
+/*
+bench_row(): Prints one measurement as a CSV row.
+
+Parameters: bench - The name of the benchmark.
+            variant - The variant being measured.
+            param - The parameter of the measurement (e.g. thread count).
+            value - The measured value.
+
+Return value: None.
+*/
+void	bench_row(char *bench, char *variant, long param, double value)
+{
+	printf("%s,%s,%ld,%.2f\n", bench, variant, param, value);
+	fflush(stdout);
+}
+
+/*
+bench_data(): Initializes a simulation data structure for a benchmark.
+
+Parameters: data - A pointer to the data structure to initialize.
+            n_philos - The number of philosophers, as a decimal string.
+            layout - The layout of the hot philosopher data and the forks.
+
+Return value: None.
+
+How it works:
+1. Builds a command line with a time to die long enough that nobody dies
+	while the benchmark runs.
+2. Initializes the data, the philosophers and the forks from it, exactly
+	as philo() does.
+*/
+void	bench_data(t_data *data, char *n_philos, t_layout layout)
+{
+	char	*av[5];
+
+	av[0] = "bench";
+	av[1] = n_philos;
+	av[2] = "2147483647";
+	av[3] = "60";
+	av[4] = "60";
+	memset(&data->opts, 0, sizeof(t_opts));
+	data->opts.layout = layout;
+	data_init(data, 5, av);
+	philo_init(data);
+	fork_init(data);
+	data->conf.start_time = get_time();
+}
+
+/*
+bench_args(): Allocates one worker argument per philosopher.
+
+Parameters: bench - A pointer to the benchmark structure.
+
+Return value: The array of worker arguments.
+*/
+t_bench_arg	*bench_args(t_bench *bench)
+{
+	t_bench_arg	*arg;
+	int			i;
+
+	arg = malloc(sizeof(t_bench_arg) * bench->data->conf.n_philos);
+	if (arg == NULL)
+		exit(1);
+	i = -1;
+	while (++i < bench->data->conf.n_philos)
+	{
+		arg[i].bench = bench;
+		arg[i].i = i;
+	}
+	return (arg);
+}
@@ -6,7 +6,7 @@
 /*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2023/12/04 20:18:23 by pmelis            #+#    #+#             */
-/*   Updated: 2023/12/12 20:09:22 by pmelis           ###   ########.fr       */
+/*   Updated: 2026/10/18 04:26:26 by pmelis           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,7 +19,23 @@
 						//free(): frees memory from heap.
 # include <unistd.h> //write()
 						//usleep(): suspend execution for microsecond intervals
-# include <sys/time.h> //gettimeofday(): returns microseconds since 1970
+# include <time.h> //clock_gettime(): monotonic nanoseconds, via the vDSO
+						//nanosleep(): TSC calibration pause
+# include <sched.h> //sched_yield(): give the CPU away in sleep tails
+# include <ucontext.h> //swapcontext(): switch between --coroutines
+# include <errno.h> //errno: retry write() on EINTR
+# include <fcntl.h> //open(): create the --trace file
+# include <sys/mman.h> //mmap(): write the --trace file through a window
+# include <sys/wait.h> //wait(): reap the --processes philosophers
+# include <sys/prctl.h> //prctl(): kill a --processes child with its parent
+# include <signal.h> //SIGKILL: the signal prctl() sends
+						//mmap(): reserve the coroutine stacks
+# include <sys/syscall.h> //syscall(): futex() for the --fork-lock locks
+# include <linux/futex.h> //FUTEX_WAIT_PRIVATE, FUTEX_WAKE_PRIVATE
+# include <limits.h> //INT_MAX: wake every futex waiter
+# include <stdint.h> //INT64_MAX: the --stats slack before the first meal
+# include <stdatomic.h> //atomic_load(), atomic_store(): lock-free accessors
+						//atomic_compare_exchange_weak(): CAS loops
 # include <pthread.h> //pthread_create(): create a new thread
 						//pthread_detach(): detach a thread
 						//pthread_join(): join with a terminated thread
@@ -38,43 +54,697 @@ typedef enum e_philo_state
 	IDLE = 5
 }	t_state;
 
+/*
+meal_word: last_meal and state packed in one 64-bit atomic so that
+philo_death() reads a consistent snapshot with a single load.
+bits 63..60: t_state | bits 59..0: last_meal.
+*/
+# define STATE_SHIFT 60
+# define MEAL_MASK 0x0FFFFFFFFFFFFFFFULL
+
+/*
+t_conf: the simulation parameters, times in microseconds. Written by
+data_init() and run_threads() before any thread is created and never
+again, so every thread reads it without synchronization. Cache-line
+aligned so that writes to the rest of t_data never invalidate it.
+*/
+# define CACHE_LINE 64
+
+typedef struct s_conf
+{
+	int			n_philos;
+	int			n_meals;
+	int			n_workers;
+	u_int64_t	us_todie;
+	u_int64_t	us_toeat;
+	u_int64_t	us_tosleep;
+	u_int64_t	start_time;
+}	__attribute__((aligned(CACHE_LINE)))	t_conf;
+
+/*
+Layouts of the hot philosopher data and of the forks, chosen at init:
+LAYOUT_PADDED gives each element its own cache line so neighbours never
+false-share, LAYOUT_PACKED stores them back to back.
+*/
+typedef enum e_layout
+{
+	LAYOUT_PADDED = 0,
+	LAYOUT_PACKED = 1
+}	t_layout;
+
+/*
+Clock sources behind get_time(). The real ones count on the CLOCK_MONOTONIC
+time base; the TSC source needs an invariant TSC and is calibrated at
+startup. The virtual one is simulated time, moved by des_run() only.
+*/
+typedef enum e_clock_src
+{
+	CLOCK_SRC_MONO = 0,
+	CLOCK_SRC_TSC = 1,
+	CLOCK_SRC_VIRTUAL = 2
+}	t_clock_src;
+
+# define TSC_CALIB_NS 20000000
+
+typedef struct s_clock
+{
+	t_clock_src	src;
+	u_int64_t	ns_base;
+	u_int64_t	tsc_base;
+	u_int64_t	mult;
+}	t_clock;
+
+/*
+ft_usleep() blocks in clock_nanosleep until slack_ns before the deadline,
+then yields until the deadline. The slack is calibrated at startup from
+SLEEP_CALIB_RUNS sleeps unless --sleep-slack sets it.
+*/
+# define SLEEP_CALIB_RUNS 20
+# define SLEEP_SLACK_MIN_NS 20000
+# define SLEEP_SLACK_MAX_NS 2000000
+
+typedef struct s_sleep
+{
+	u_int64_t			slack_ns;
+	int					report;
+	_Atomic u_int64_t	n_sleeps;
+	_Atomic u_int64_t	total_ns;
+	_Atomic u_int64_t	max_ns;
+}	t_sleep;
+
+/*
+t_hist: an HDR-style histogram of microsecond values. Values below
+HIST_SUB have a bucket each; above, every power of two is cut into
+HIST_SUB buckets, so a bucket is never wider than 1/HIST_SUB of its
+values, about 6%, whatever their magnitude. n and max are exact.
+--death-report keeps one for the deaths, timed when the log writer writes
+"died", and one for the near-misses: philosophers the death monitor found
+past their deadline but eating.
+*/
+# define HIST_SUB_BITS 4
+# define HIST_SUB 16
+# define HIST_BUCKETS 976
+# define DEATH_SLA_US 10000
+
+typedef struct s_hist
+{
+	_Atomic u_int64_t	count[HIST_BUCKETS];
+	_Atomic u_int64_t	n;
+	_Atomic u_int64_t	max;
+}	t_hist;
+
+typedef struct s_death_stats
+{
+	int		report;
+	t_hist	died;
+	t_hist	near;
+}	t_death_stats;
+
+/*
+t_outcome: what a --sweep run gathers from its log instead of printing it.
+last holds each philosopher's last meal time plus one, 0 before its first
+meal. hunger is the longest wait for a meal, from the start, from a meal,
+or up to a death; period_min and period_max bound the time between two
+meals of a philosopher.
+*/
+typedef struct s_outcome
+{
+	int			died;
+	u_int64_t	death_us;
+	u_int64_t	meals;
+	u_int64_t	*last;
+	u_int64_t	hunger;
+	u_int64_t	period_min;
+	u_int64_t	period_max;
+}	t_outcome;
+
+typedef enum e_sweep_fmt
+{
+	SWEEP_OFF = 0,
+	SWEEP_CSV = 1,
+	SWEEP_JSON = 2
+}	t_sweep_fmt;
+
+typedef enum e_predict_mode
+{
+	PREDICT_OFF = 0,
+	PREDICT_REPORT = 1,
+	PREDICT_ONLY = 2
+}	t_predict_mode;
+
+/*
+--forks=<strategy>: how a philosopher thread gets its two forks.
+FORKS_ORDER, the default, takes them in an order that alternates around
+the table; FORKS_WAITER asks a central waiter, which lends both at once;
+FORKS_CHANDY passes forks on request with the Chandy-Misra dirty/clean
+rule; FORKS_TICKET lets n - 1 philosophers at a time reach for their
+forks, in the order they drew a ticket; FORKS_HUNGER takes them in the
+same order as FORKS_ORDER, but a contested fork goes to the neighbour
+closest to death.
+*/
+typedef enum e_forks_algo
+{
+	FORKS_ORDER = 0,
+	FORKS_WAITER = 1,
+	FORKS_CHANDY = 2,
+	FORKS_TICKET = 3,
+	FORKS_HUNGER = 4
+}	t_forks_algo;
+
+/*
+--fork-lock=<lock>: the lock behind fork_lock() in thread mode. LOCK_MUTEX,
+the default, is the fork's pthread mutex; LOCK_TICKET serves the
+neighbours in the order they asked; LOCK_MCS queues them, each spinning on
+its own node; LOCK_ADAPTIVE spins while the holder's meal is about to
+end, see FORK_SPIN_US, and parks in the kernel otherwise; LOCK_HANDOFF
+gives a dropped fork straight to the neighbour waiting for it.
+*/
+typedef enum e_lock_kind
+{
+	LOCK_MUTEX = 0,
+	LOCK_TICKET = 1,
+	LOCK_MCS = 2,
+	LOCK_ADAPTIVE = 3,
+	LOCK_HANDOFF = 4
+}	t_lock_kind;
+
+typedef struct s_opts
+{
+	t_layout		layout;
+	t_clock_src		clock;
+	u_int64_t		sleep_slack_us;
+	int				sleep_report;
+	char			*trace;
+	u_int64_t		workers;
+	int				coroutines;
+	t_sweep_fmt		sweep;
+	t_outcome		*outcome;
+	t_predict_mode	predict;
+	t_forks_algo	forks;
+	int				fork_stats;
+	t_lock_kind		fork_lock;
+	int				processes;
+	int				death_report;
+	int				stats;
+	char			*metrics;
+}	t_opts;
+
+/*
+t_fork: mu is the fork of the thread-per-philosopher mode. The worker pool
+cannot block on it and uses state instead: FORK_FREE, FORK_TAKEN, or
+FORK_WAITED when the other neighbour is parked waiting for it. The
+--fork-lock locks use the other fields: ticket holds the next ticket to
+draw in its high 16 bits and the ticket served in its low 16 bits; tail is
+the last node of the MCS queue; the adaptive lock uses state as a futex
+word, and until is the time its holder is expected to drop it. The
+hand-off lock uses state as a futex word too: the id of the philosopher
+holding the fork in its low 16 bits, and of the one waiting for it in its
+high 16 bits, 0 for none.
+t_mcs_node: a philosopher's place in the queue of one of its forks.
+*/
+# define FORK_FREE 0
+# define FORK_TAKEN 1
+# define FORK_WAITED 2
+# define FORK_SPIN_US 50
+
+typedef struct s_mcs_node
+{
+	_Atomic(struct s_mcs_node *)	next;
+	atomic_int						locked;
+}	t_mcs_node;
+
+typedef struct s_fork
+{
+	pthread_mutex_t					mu;
+	atomic_int						state;
+	atomic_uint						ticket;
+	_Atomic(struct s_mcs_node *)	tail;
+	_Atomic u_int64_t				until;
+}	t_fork;
+
+/*
+t_span: how many times something took how long, in microseconds: count,
+sum, shortest and longest, for the --stats table.
+t_stat: the spans every philosopher keeps, in t_philo->stats: its waits
+in take_both(), and how long its meals and sleeps really lasted.
+*/
+typedef struct s_span
+{
+	u_int64_t	n;
+	u_int64_t	sum;
+	u_int64_t	min;
+	u_int64_t	max;
+}	t_span;
+
+typedef enum e_stat
+{
+	STAT_WAIT = 0,
+	STAT_EAT = 1,
+	STAT_SLEEP = 2,
+	STAT_N = 3
+}	t_stat;
+
+/*
+t_philo_hot: the fields written on every meal and polled by the monitors,
+and the --stats counters: the spans of its waits, meals and sleeps, and
+the least time it had left before its deadline when it started eating.
+In task mode, since is when its current fork wait or sleep began.
+Only the philosopher's own thread (or task) writes the hot part, which
+has cache lines of its own in the padded layout, so the counters are
+never shared and cost no atomics.
+t_philo: the cold fields, written once by philo_init() and fork_init(),
+its MCS nodes for its left and right forks, which its neighbours spin on,
+and the deadline of its last near-miss, which only the death monitor
+writes.
+*/
+typedef struct s_philo_hot
+{
+	_Atomic u_int64_t	meal_word;
+	atomic_int			n_meals;
+	int64_t				slack_min_us;
+	u_int64_t			since;
+	t_span				stats[STAT_N];
+}	t_philo_hot;
+
 typedef struct s_philo
 {
 	int				id;
-	int				n_meals;
 	struct s_data	*data;
-	u_int64_t		last_meal;
-	t_state			state;
-	pthread_mutex_t	n_meals_mu;	
-	pthread_mutex_t	last_meal_mu;
-	pthread_mutex_t	state_mu;
-	pthread_mutex_t	*left_f;
-	pthread_mutex_t	*right_f;
+	t_philo_hot		*hot;
+	t_fork			*left_f;
+	t_fork			*right_f;
+	struct s_dl		*dl;
+	u_int64_t		noticed_us;
+	t_mcs_node		mcs[2];
 }	t_philo;
 
+/*
+t_deadlines: min-heap of the philosophers' death deadlines (last meal +
+time to die), updated by update_last_meal(). pos[i] is the heap index of
+philosopher i. The monitor sleeps on cv until the earliest deadline. The
+parallel virtual-time simulation gives each worker a heap of its own over
+its slice of heap; philo->dl is the heap a philosopher is in. lag_us is
+how late the monitor last woke up from its sleep until a deadline, for
+--metrics.
+*/
+# define DL_RECHECK_US 500
+
+typedef struct s_dl_node
+{
+	u_int64_t	key;
+	int			philo;
+}	t_dl_node;
+
+typedef struct s_dl
+{
+	pthread_mutex_t		mu;
+	pthread_cond_t		cv;
+	t_dl_node			*heap;
+	int					*pos;
+	int					n;
+	_Atomic u_int64_t	lag_us;
+}	t_deadlines;
+
+/*
+t_full: number of philosophers that had their required meals. The last one
+to get there wakes the completion monitor sleeping on cv.
+*/
+typedef struct s_full
+{
+	pthread_mutex_t	mu;
+	pthread_cond_t	cv;
+	atomic_int		n;
+}	t_full;
+
+/*
+Messages of the log. print_changestate() pushes them as fixed-size events
+into the calling thread's ring; the writer thread formats them.
+*/
+typedef enum e_msg
+{
+	MSG_FORK = 0,
+	MSG_EAT = 1,
+	MSG_SLEEP = 2,
+	MSG_THINK = 3,
+	MSG_DIED = 4
+}	t_msg;
+
+/*
+t_ring: single-producer single-consumer ring of log events. There is one
+per philosopher, or per pool worker, and one for the death monitor. Its
+size events live in log.events: LOG_RING_SIZE per philosopher thread, or
+POOL_RING_SIZE per worker, which logs for many philosophers at once. busy
+is the timestamp of the event being pushed, 0 while its clock is being
+read and LOG_IDLE otherwise:
+the writer only merges events up to the smallest busy timestamp, so events
+still on their way cannot end up out of order.
+t_log: the rings and the writer thread's private output buffer, which
+log_format() fills with whole lines and log_flush() writes in one call.
+*/
+# define LOG_RING_SIZE 256
+# define POOL_RING_SIZE 65536
+# define LOG_FLUSH_US 1000
+# define LOG_BUF_SIZE 65536
+# define LOG_LINE_MAX 64
+# define LOG_IDLE 0xFFFFFFFFFFFFFFFFULL
+
+typedef struct s_log_event
+{
+	u_int64_t	ts;
+	int			id;
+	t_msg		msg;
+}	t_log_event;
+
+typedef struct s_ring
+{
+	_Alignas(CACHE_LINE) _Atomic u_int64_t	head;
+	_Atomic u_int64_t						busy;
+	t_log_event								*ev;
+	u_int64_t								size;
+	_Alignas(CACHE_LINE) _Atomic u_int64_t	tail;
+}	t_ring;
+
+/*
+Binary trace written by the log writer with --trace=<file>: a t_trace_hdr,
+then one t_trace_rec per event in timestamp order. delta is the time since
+the previous record, or since the start for the first one, in microseconds;
+longer gaps are split with TRACE_GAP records. id_msg is id << 8 | msg.
+The file grows by TRACE_CHUNK and is written through an mmap'd window of
+that size.
+*/
+# define TRACE_MAGIC 0x52544850
+# define TRACE_VERSION 1
+# define TRACE_CHUNK 16777216
+# define TRACE_GAP 255
+
+typedef struct s_trace_hdr
+{
+	u_int32_t	magic;
+	u_int32_t	version;
+	u_int32_t	n_philos;
+	u_int32_t	rec_size;
+	u_int64_t	n_recs;
+	u_int64_t	reserved[5];
+}	t_trace_hdr;
+
+typedef struct s_trace_rec
+{
+	u_int32_t	delta;
+	u_int32_t	id_msg;
+}	t_trace_rec;
+
+typedef struct s_trace
+{
+	int			fd;
+	char		*map;
+	u_int64_t	map_off;
+	u_int64_t	off;
+	u_int64_t	last_ts;
+	u_int64_t	n_recs;
+}	t_trace;
+
+/*
+Live metrics page written by the log writer with --metrics=<file>, for
+philo_top: a t_metrics_hdr, then one t_metrics_philo per philosopher.
+Every METRICS_PERIOD_US the writer copies the philosophers' meal words and
+meal counts into it under a seqlock: seq is odd while it writes, and a
+reader copies the page until it saw the same even seq before and after.
+Nobody waits for anybody, and the philosophers never touch the page.
+The meals per second are over the last METRICS_RATE_US, and over the whole
+run once running drops to 0 with the last update.
+*/
+# define METRICS_MAGIC 0x4D544850
+# define METRICS_VERSION 1
+# define METRICS_PERIOD_US 100000
+# define METRICS_RATE_US 1000000
+
+typedef struct s_metrics_hdr
+{
+	u_int32_t			magic;
+	u_int32_t			version;
+	u_int32_t			n_philos;
+	u_int32_t			running;
+	_Atomic u_int64_t	seq;
+	u_int64_t			us_todie;
+	u_int64_t			elapsed_us;
+	u_int64_t			meals;
+	double				meals_per_s;
+	u_int64_t			monitor_lag_us;
+	u_int64_t			reserved[3];
+}	t_metrics_hdr;
+
+typedef struct s_metrics_philo
+{
+	u_int32_t	state;
+	u_int32_t	meals;
+	u_int64_t	meal_age_us;
+}	t_metrics_philo;
+
+typedef struct s_metrics
+{
+	t_metrics_hdr	*hdr;
+	size_t			len;
+	u_int64_t		next;
+	u_int64_t		last_meals;
+	u_int64_t		last_at;
+}	t_metrics;
+
+typedef struct s_log
+{
+	t_ring			*rings;
+	t_log_event		*events;
+	int				n_rings;
+	int				ring_size;
+	atomic_int		stop;
+	int				died;
+	pthread_t		writer;
+	t_trace			trace;
+	t_metrics		metrics;
+	size_t			buf_len;
+	char			buf[LOG_BUF_SIZE];
+}	t_log;
+
+/*
+Worker pool, used with --workers or --pool: philosophers are tasks run by
+a fixed set of worker threads instead of one thread each. task_step() runs
+a task until it has to wait, for a fork, which parks it until the
+neighbour drops the fork and calls resume, or for a time, which parks it
+in its worker's timer heap. Ready tasks sit in the workers' run queues;
+an idle worker steals from the others. Each worker owns a contiguous
+segment of the table, see pool_owner().
+In virtual time, the workers take every time step together: barrier, the
+start mutex, and the round flags (granted), next event times (next) and
+first dead philosopher (dead) that they agree on between two barriers,
+see des_sync(). A fork is not taken during a drain but asked for, in its
+want bits, and filed in the pend list of the worker owning it, which
+grants it between two barriers, see des_grant().
+With --coroutines, worker 0 is a scheduler instead: every philosopher
+runs routine() as a coroutine (cos) on its own CO_STACK_SIZE stack, cut
+from one reservation (stacks), with a PROT_NONE guard page below each. A coroutine switches back to the
+scheduler's context (main) when it sleeps, through the timer heap, and
+when it waits for a fork, which parks it like a task.
+*/
+# define POOL_MAX_PHILOS 1000000
+# define POOL_MAX_WORKERS 1024
+# define POOL_IDLE_US 1000
+# define DES_NEVER 0xFFFFFFFFFFFFFFFFULL
+# define DES_WANT_LEFT 1
+# define DES_WANT_RIGHT 2
+# define DES_WANT_BOTH 3
+# define CO_STACK_SIZE 16384
+
+typedef enum e_step
+{
+	STEP_START = 0,
+	STEP_FIRST = 1,
+	STEP_SECOND = 2,
+	STEP_EATEN = 3,
+	STEP_SLEPT = 4
+}	t_step;
+
+typedef enum e_run
+{
+	RUN_READY = 0,
+	RUN_TIMER = 1,
+	RUN_PARKED = 2,
+	RUN_DONE = 3
+}	t_run;
+
+typedef struct s_worker
+{
+	pthread_mutex_t	mu;
+	pthread_cond_t	cv;
+	int				*queue;
+	int				q_head;
+	int				q_len;
+	int				q_cap;
+	int				idle;
+	t_dl_node		*timers;
+	int				n_timers;
+	int				t_cap;
+	t_deadlines		dl;
+	int				*pend;
+	atomic_int		p_len;
+	int				p_cap;
+	int				round;
+	int				id;
+	struct s_data	*data;
+	pthread_t		th;
+}	__attribute__((aligned(CACHE_LINE)))	t_worker;
+
+typedef struct s_co
+{
+	ucontext_t		ctx;
+	struct s_philo	*philo;
+}	t_co;
+
+typedef struct s_pool
+{
+	t_worker			*workers;
+	t_step				*steps;
+	atomic_int			n_idle;
+	void				(*resume)(struct s_data *data, int i);
+	pthread_barrier_t	barrier;
+	pthread_mutex_t		start;
+	atomic_int			*want;
+	atomic_int			granted[3];
+	atomic_int			dead;
+	_Atomic u_int64_t	next[3];
+	t_co				*cos;
+	char				*stacks;
+	size_t				stacks_len;
+	ucontext_t			main;
+	_Atomic u_int64_t	*vclock;
+}	t_pool;
+
+/*
+t_strategy: the take and drop functions of a --forks strategy.
+t_arbiter: its shared state. mu and cv guard the waiter's busy forks and
+the ticket counters: ticket next is drawn next, done tickets were given
+back, and a ticket is served once it is below done + tokens. The
+Chandy-Misra and hunger strategies keep their state per fork, in fork,
+under the fork's mu: whether it is used, by a meal or by the philosopher
+it was granted to. For Chandy-Misra, the philosopher owning the fork and
+whether it is dirty: an owner gives a dirty fork it does not use away to
+the neighbour asking for it, clean; it keeps a clean one until its meal.
+For hunger, the death deadline of the neighbour waiting for the fork on
+its left (want[0]) and on its right (want[1]), 0 if none: a free fork
+goes to the waiter that dies first.
+*/
+typedef struct s_strategy
+{
+	char	*name;
+	int		(*take)(struct s_philo *philo);
+	void	(*drop)(struct s_philo *philo);
+}	t_strategy;
+
+typedef struct s_arb_fork
+{
+	pthread_cond_t	cv;
+	int				owner;
+	int				dirty;
+	int				used;
+	u_int64_t		want[2];
+}	t_arb_fork;
+
+typedef struct s_arbiter
+{
+	const t_strategy	*s;
+	pthread_mutex_t		mu;
+	pthread_cond_t		cv;
+	int					*busy;
+	t_arb_fork			*fork;
+	u_int64_t			next;
+	u_int64_t			done;
+	u_int64_t			tokens;
+}	t_arbiter;
+
+/*
+--processes: every philosopher is a forked child. The data structure, the
+arrays data_malloc() allocates and their mutexes and condition variables,
+made process-shared, live in one shared anonymous mapping carved up by
+shm_alloc(), so a child's meals, forks and log events are the parent's.
+The parent is the supervisor: it runs the death monitor itself.
+*/
+typedef struct s_shm
+{
+	char	*base;
+	size_t	len;
+	size_t	off;
+}	t_shm;
+
 typedef struct s_data
 {
-	int				n_philos;
-	u_int64_t		ms_todie;
-	u_int64_t		ms_toeat;
-	u_int64_t		ms_tosleep;
-	int				n_meals;
-	u_int64_t		start_time;
-	int				keep_iter;
-	pthread_mutex_t	ms_todie_mu;
-	pthread_mutex_t	ms_toeat_mu;
-	pthread_mutex_t	ms_tosleep_mu;
-	pthread_mutex_t	start_time_mu;
-	pthread_mutex_t	n_philos_mu;
-	pthread_mutex_t	keep_iter_mu;
-	pthread_mutex_t	print_mu;
-	pthread_mutex_t	*forks;
+	t_conf			conf;
+	_Alignas(CACHE_LINE) atomic_int	keep_iter;
+	t_deadlines		dl;
+	t_full			full;
+	t_log			log;
+	t_pool			pool;
+	t_arbiter		arb;
+	t_opts			opts;
+	size_t			fork_stride;
+	size_t			hot_stride;
+	void			*forks;
+	void			*hot;
 	t_philo			*philo;
 	pthread_t		*philo_th;
 	pthread_t		monit_all_alive;
 	pthread_t		monit_all_full;
 }	t_data;
 
+/*
+--sweep: every positional argument is a range lo[:hi[:step]], and every
+combination runs as its own simulation, SWEEP_MEALS meals each unless the
+meals are given. Runners, one per online core, take the next run from the
+next counter; each binds its own virtual clock, so virtual-time runs
+are isolated too.
+*/
+# define SWEEP_MAX_RUNS 100000
+# define SWEEP_MEALS 10
+# define SWEEP_ARGS 5
+
+typedef struct s_range
+{
+	u_int64_t	lo;
+	u_int64_t	step;
+	u_int64_t	n;
+}	t_range;
+
+typedef struct s_sweep_run
+{
+	int			arg[SWEEP_ARGS];
+	int			err;
+	int			predicted;
+	t_outcome	out;
+}	t_sweep_run;
+
+/*
+t_predict: the outcome predict() expects from a run's arguments. The table
+eats in phases: 2 groups taking turns with an even number of
+philosophers, 3 with an odd one, as think_time() enforces, so everyone
+starts a meal every period_us. margin_us is the time to die minus that
+period. death_us is the time of the first death and full_us the time the
+last required meal ends, -1 if there is none.
+*/
+typedef struct s_predict
+{
+	int		phases;
+	long	period_us;
+	long	margin_us;
+	long	death_us;
+	long	full_us;
+}	t_predict;
+
+typedef struct s_sweep
+{
+	t_range		range[SWEEP_ARGS];
+	t_opts		opts;
+	t_sweep_run	*runs;
+	int			n_runs;
+	atomic_int	next;
+}	t_sweep;
+
 ////////////////////
 /////activities/////
 ////////////////////
@@ -82,6 +752,7 @@ int			think(t_philo *philo);
 int			ft_sleep(t_philo *philo);
 int			eat(t_philo *philo);
 void		free_data(t_data *data);
+void		free_arrays(t_data *data);
 
 ///////////////////
 /////data_init/////
@@ -91,6 +762,309 @@ int			philo_init(t_data *data);
 int			data_malloc(t_data *data);
 int			data_init(t_data *data, int ac, char **av);
 
+///////////////
+/////clock/////
+///////////////
+u_int64_t	mono_ns(void);
+int			clock_init(t_clock_src src);
+u_int64_t	clock_ns(void);
+u_int64_t	get_time(void);
+void		clock_to_mono(u_int64_t time, struct timespec *ts);
+
+///////////////////
+/////clock_tsc/////
+///////////////////
+u_int64_t	tsc_read(void);
+int			tsc_available(void);
+void		tsc_calibrate(t_clock *clock);
+
+///////////////////////
+/////clock_virtual/////
+///////////////////////
+u_int64_t	virtual_ns(void);
+void		virtual_advance(u_int64_t time);
+void		virtual_bind(_Atomic u_int64_t *clock);
+_Atomic u_int64_t	*virtual_clock(void);
+
+//////////////////
+/////deadline/////
+//////////////////
+void		dl_update(t_deadlines *dl, int philo, u_int64_t key);
+void		dl_init(t_deadlines *dl, t_data *data, int lo, int hi);
+
+///////////////////////
+/////deadline_wait/////
+///////////////////////
+int			dl_next_due(t_data *data);
+void		dl_postpone(t_data *data, int i);
+void		dl_destroy(t_deadlines *dl);
+
+/////////////
+/////log/////
+/////////////
+void		log_init(t_data *data);
+void		log_attach(t_data *data, int ring);
+void		log_push(int id, t_msg msg);
+int			log_start(t_data *data);
+void		log_stop(t_data *data);
+
+////////////////////
+/////log_writer/////
+////////////////////
+void		log_flush(t_log *log);
+void		*log_writer(void *data_p);
+
+///////////////
+/////trace/////
+///////////////
+int			trace_open(t_trace *trace, char *path);
+void		trace_record(t_trace *trace, u_int64_t ts, int id, t_msg msg);
+void		trace_close(t_trace *trace, int n_philos);
+
+//////////////
+/////task/////
+//////////////
+t_run		task_step(t_data *data, int i, u_int64_t *wake);
+
+///////////////////
+/////pool_fork/////
+///////////////////
+int			pfork_take(t_data *data, int i, t_fork *fork);
+void		pfork_drop(t_data *data, int i, t_fork *fork);
+int			pool_owner(t_data *data, int i);
+
+//////////////
+/////pool/////
+//////////////
+int			pool_init(t_data *data);
+int			pool_start(t_data *data);
+void		pool_join(t_data *data);
+void		pool_free(t_data *data);
+
+////////////////////
+/////pool_queue/////
+////////////////////
+int			queue_push(t_worker *w, int i);
+int			queue_pop(t_worker *w, int *i);
+int			queue_steal_any(t_data *data, t_worker *w, int *i);
+
+////////////////////
+/////pool_timer/////
+////////////////////
+int			timer_push(t_worker *w, u_int64_t wake, int i);
+int			timer_pop(t_worker *w, u_int64_t now, int *i);
+int			timer_expire(t_worker *w);
+
+/////////////////////
+/////pool_worker/////
+/////////////////////
+void		worker_idle(t_worker *w);
+void		pool_resume(t_data *data, int i);
+void		pool_wake_all(t_data *data);
+void		*worker_routine(void *worker_p);
+
+/////////////
+/////des/////
+/////////////
+void		des_drain(t_worker *w);
+void		des_due(t_worker *w, u_int64_t now);
+int			des_died(t_worker *w);
+
+//////////////////
+/////des_fork/////
+//////////////////
+int			des_take(t_data *data, int i, t_fork *fork);
+void		des_drop(t_data *data, int i, t_fork *fork);
+void		des_grant(t_worker *w);
+
+//////////////////
+/////des_init/////
+//////////////////
+int			des_init(t_data *data);
+void		des_segments(t_data *data);
+
+/////////////////
+/////des_run/////
+/////////////////
+void		*des_routine(void *worker_p);
+int			des_run(t_data *data);
+
+////////////
+/////co/////
+////////////
+t_co		*co_current(void);
+void		co_switch(t_data *data, int i);
+void		co_park(void);
+u_int64_t	co_sleep(u_int64_t sleep_time);
+void		co_resume(t_data *data, int i);
+
+//////////////////
+/////co_sched/////
+//////////////////
+int			co_init(t_data *data);
+void		*co_routine(void *data_p);
+void		co_free(t_data *data);
+
+///////////////////
+/////fork_lock/////
+///////////////////
+void		fork_lock(t_philo *philo, t_fork *fork);
+void		fork_unlock(t_philo *philo, t_fork *fork);
+
+///////////////
+/////flock/////
+///////////////
+int			parse_fork_lock(char *val, t_opts *opts);
+void		futex_wait(void *addr, unsigned int val);
+void		futex_wake(void *addr, int n);
+void		ticket_lock(t_fork *fork);
+void		ticket_unlock(t_fork *fork);
+
+///////////////////
+/////flock_mcs/////
+///////////////////
+void		mcs_lock(t_fork *fork, t_mcs_node *node);
+void		mcs_unlock(t_fork *fork, t_mcs_node *node);
+
+////////////////////////
+/////flock_adaptive/////
+////////////////////////
+void		adaptive_lock(t_fork *fork, u_int64_t hold_us);
+void		adaptive_unlock(t_fork *fork);
+
+///////////////////////
+/////flock_handoff/////
+///////////////////////
+void		handoff_lock(t_fork *fork, int id);
+void		handoff_unlock(t_fork *fork);
+
+///////////////
+/////sweep/////
+///////////////
+int			parse_sweep(char *arg, t_opts *opts);
+int			sweep_main(int ac, char **av, t_opts *opts);
+
+///////////////////
+/////sweep_run/////
+///////////////////
+int			sweep_start(t_sweep *sw);
+
+///////////////////
+/////sweep_out/////
+///////////////////
+void		outcome_record(t_data *data, t_log_event *ev);
+void		sweep_print(t_sweep *sw);
+
+/////////////////
+/////predict/////
+/////////////////
+int			parse_predict(char *arg, t_opts *opts);
+void		predict(t_predict *p, int *arg);
+void		predict_print(t_predict *p, int *arg, FILE *stream);
+int			predict_main(int ac, char **av, t_opts *opts);
+
+////////////////////
+/////log_format/////
+////////////////////
+size_t		log_format(char *dst, u_int64_t ms, int id, t_msg msg);
+
+//////////////
+/////full/////
+//////////////
+void		full_init(t_data *data);
+void		full_signal(t_data *data);
+int			full_wait(t_data *data);
+void		full_destroy(t_data *data);
+
+////////////////
+/////layout/////
+////////////////
+size_t		layout_stride(t_data *data, size_t size);
+void		*layout_alloc(t_data *data, size_t stride);
+t_fork		*fork_at(t_data *data, int i);
+t_philo_hot	*hot_at(t_data *data, int i);
+
+//////////////
+/////opts/////
+//////////////
+int			parse_opts(int *ac, char **av, t_opts *opts);
+int			parse_opt(char *arg, t_opts *opts);
+char		*opt_value(char *arg, char *name);
+int			opt_flag(char *arg, char *name);
+
+////////////////////
+/////opts_usage/////
+////////////////////
+void		print_opts(void);
+int			opts_check(t_opts *opts);
+
+/////////////////////
+/////opts_values/////
+/////////////////////
+int			parse_layout(char *val, t_opts *opts);
+int			parse_clock(char *val, t_opts *opts);
+int			parse_uint(char *val, u_int64_t max, u_int64_t *out);
+int			parse_pool(char *arg, t_opts *opts);
+int			max_philos(t_opts *opts);
+
+////////////////////////
+/////forks_strategy/////
+////////////////////////
+int			parse_forks(char *val, t_opts *opts);
+int			strategy_init(t_data *data);
+void		strategy_wake(t_data *data);
+void		strategy_free(t_data *data);
+
+/////////////////////
+/////forks_stats/////
+/////////////////////
+void		forks_report(t_data *data);
+
+/////////////////////
+/////forks_order/////
+/////////////////////
+int			order_take(t_philo *philo);
+void		order_drop(t_philo *philo);
+
+//////////////////////
+/////forks_waiter/////
+//////////////////////
+int			waiter_take(t_philo *philo);
+void		waiter_drop(t_philo *philo);
+
+//////////////////////
+/////forks_chandy/////
+//////////////////////
+int			cm_take(t_philo *philo);
+void		cm_drop(t_philo *philo);
+
+//////////////////////
+/////forks_ticket/////
+//////////////////////
+int			ticket_take(t_philo *philo);
+void		ticket_drop(t_philo *philo);
+
+//////////////////////
+/////forks_hunger/////
+//////////////////////
+void		hunger_lock(t_philo *philo, t_fork *fork);
+void		hunger_unlock(t_philo *philo, t_fork *fork);
+
+//////////////
+/////proc/////
+//////////////
+int			proc_check(t_opts *opts);
+int			proc_start(t_data *data);
+int			proc_join(t_data *data);
+
+//////////////////
+/////proc_shm/////
+//////////////////
+t_data		*proc_map(int n_philos);
+void		proc_unmap(void);
+void		*data_alloc(t_data *data, size_t size, int align);
+void		sync_init(t_data *data, pthread_mutex_t *mu, pthread_cond_t *cv);
+
 /////////////
 /////eat/////
 /////////////
@@ -113,13 +1087,14 @@ int			take_both(t_philo *philo);
 /////////////////
 int			handle_1(t_philo *philo);
 int			n_meal_trigger(t_data *data);
-void		print_changestate(t_data *data, int id, char *msg);
+void		print_changestate(t_data *data, int id, t_msg msg);
+u_int64_t	think_time(t_data *data);
 
 /////////////////////
 /////input_check/////
 /////////////////////
-int			input_check(int ac, char **av);
-int			wrong_input(int ac, char **av);
+int			input_check(int ac, char **av, int max_philos);
+int			wrong_input(int ac, char **av, int max_philos);
 int			is_digit(int ac, char **av);
 int			ft_atoi(char *str);
 void		print_error(void);
@@ -146,6 +1121,14 @@ u_int64_t	pull_start_time(t_data *data);
 ///////////////////
 void		push_philo_state(t_philo *philo, t_state state);
 void		push_keep_iter(t_data *data, int set_to);
+u_int64_t	pack_meal_word(u_int64_t last_meal, t_state state);
+
+///////////////
+/////philo/////
+///////////////
+int			run_threads(t_data *data);
+int			join_threads(t_data *data);
+int			philo(int ac, char **av, t_opts *opts);
 
 /////////////////
 /////routine/////
@@ -157,10 +1140,48 @@ void		*all_alive_routine(void *data_p);
 ////////////////////
 /////supervisor/////
 ////////////////////
-int			is_full(t_data *data, t_philo *philo);
 int			philo_death(t_philo *philo);
 void		notify_all(t_data *data);
-u_int64_t	get_time(void);
-void		ft_usleep(u_int64_t sleep_time);
+
+///////////////
+/////sleep/////
+///////////////
+void		sleep_init(u_int64_t slack_us, int report);
+u_int64_t	ft_usleep(u_int64_t sleep_time);
+void		sleep_report(void);
+void		sleep_share(t_sleep *shared);
+
+//////////////////////
+/////sleep_report/////
+//////////////////////
+void		sleep_record(t_sleep *sleep, u_int64_t over_ns);
+void		sleep_print(t_sleep *sleep);
+
+//////////////
+/////hist/////
+//////////////
+void		hist_record(t_hist *hist, u_int64_t value);
+u_int64_t	hist_pct(t_hist *hist, double pct);
+
+//////////////////////
+/////death_report/////
+//////////////////////
+void		death_init(int report);
+void		death_note(t_data *data, int i, int died);
+void		death_report(void);
+
+///////////////
+/////stats/////
+///////////////
+void		stats_init(t_philo_hot *hot);
+void		stats_span(t_span *span, u_int64_t us);
+void		stats_report(t_data *data);
+
+/////////////////
+/////metrics/////
+/////////////////
+int			metrics_open(t_data *data, char *path);
+void		metrics_publish(t_data *data, int last);
+void		metrics_close(t_data *data);
 
 #endif
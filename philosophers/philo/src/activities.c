@@ -6,7 +6,7 @@
 /*   By: pmelis <pmelis@student.42wolfsburg.de>     +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2023/12/05 15:26:21 by pmelis            #+#    #+#             */
-/*   Updated: 2023/12/09 20:11:53 by pmelis           ###   ########.fr       */
+/*   Updated: 2026/10/18 04:24:17 by pmelis           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -23,13 +23,16 @@ How it works:
 1. Sets the philosopher's state to THINKING.
 2. Checks if the philosopher is dead.
 3. If not, prints a message indicating the philosopher is thinking.
+4. Thinks for think_time(), which is only non-zero on odd tables.
 */
 int	think(t_philo *philo)
 {
 	push_philo_state(philo, THINKING);
 	if (pull_philo_state(philo) == DEAD)
 		return (1);
-	print_changestate(philo->data, philo->id, "is thinking");
+	print_changestate(philo->data, philo->id, MSG_THINK);
+	if (think_time(philo->data))
+		ft_usleep(think_time(philo->data));
 	return (0);
 }
 
@@ -44,15 +47,17 @@ How it works:
 1. Sets the philosopher's state to SLEEPING.
 2. Checks if the philosopher is dead.
 3. If not, prints a message indicating the philosopher is sleeping.
-4. The philosopher sleeps for a certain amount of time.
+4. The philosopher sleeps for a certain amount of time, which is added,
+	with how late ft_usleep returned, to its sleep span.
 */
 int	ft_sleep(t_philo *philo)
 {
 	push_philo_state(philo, SLEEPING);
 	if (pull_philo_state(philo) == DEAD)
 		return (1);
-	print_changestate(philo->data, philo->id, "is sleeping");
-	ft_usleep(pull_sleep_time(philo->data));
+	print_changestate(philo->data, philo->id, MSG_SLEEP);
+	stats_span(&philo->hot->stats[STAT_SLEEP], pull_sleep_time(philo->data)
+		+ ft_usleep(pull_sleep_time(philo->data)));
 	return (0);
 }
 
@@ -77,7 +82,7 @@ int	eat(t_philo *philo)
 	if (take_both(philo) != 0)
 		return (1);
 	push_philo_state(philo, EATING);
-	print_changestate(philo->data, philo->id, "is eating");
+	print_changestate(philo->data, philo->id, MSG_EAT);
 	update_last_meal(philo);
 	sleep_for_eating(philo);
 	update_n_meals(philo);
@@ -95,10 +100,11 @@ Return value: None.
 
 How it works:
 1. Retrieves the number of philosophers.
-2. Iterates over each philosopher, destroying their individual mutexes.
-3. Destroys the mutexes associated with the data structure.
-4. Frees the memory allocated for the philosopher threads,
-	the philosophers, and the forks.
+2. Iterates over each philosopher, destroying their forks' mutexes.
+3. Destroys the mutexes and condition variables of the deadline heap,
+	of the satisfied counter and of the --forks strategy, and the worker
+	pool, if any.
+4. Frees the arrays using free_arrays.
 */
 void	free_data(t_data *data)
 {
@@ -108,20 +114,43 @@ void	free_data(t_data *data)
 	i = -1;
 	n_philos = pull_n_philos(data);
 	while (++i < n_philos)
+		pthread_mutex_destroy(&fork_at(data, i)->mu);
+	dl_destroy(&data->dl);
+	full_destroy(data);
+	strategy_free(data);
+	if (data->conf.n_workers)
+		pool_free(data);
+	free_arrays(data);
+}
+
+/*
+free_arrays(): Frees the arrays allocated by data_malloc().
+
+Parameters: data - A pointer to the data structure.
+
+Return value: None.
+
+How it works:
+1. With --processes, unmaps the shared mapping with proc_unmap(): the
+	arrays, and the data structure itself, go at once. This is the last
+	use of data.
+2. Otherwise frees every array. Arrays whose allocation failed are NULL,
+	which free ignores, so this also cleans up after a partial
+	data_malloc().
+*/
+void	free_arrays(t_data *data)
+{
+	if (data->opts.processes)
 	{
-		pthread_mutex_destroy(&data->forks[i]);
-		pthread_mutex_destroy(&data->philo[i].n_meals_mu);
-		pthread_mutex_destroy(&data->philo[i].last_meal_mu);
-		pthread_mutex_destroy(&data->philo[i].state_mu);
+		proc_unmap();
+		return ;
 	}
-	pthread_mutex_destroy(&data->ms_toeat_mu);
-	pthread_mutex_destroy(&data->ms_todie_mu);
-	pthread_mutex_destroy(&data->ms_tosleep_mu);
-	pthread_mutex_destroy(&data->keep_iter_mu);
-	pthread_mutex_destroy(&data->n_philos_mu);
-	pthread_mutex_destroy(&data->start_time_mu);
-	pthread_mutex_destroy(&data->print_mu);
 	free(data->philo_th);
 	free(data->philo);
+	free(data->hot);
 	free(data->forks);
+	free(data->dl.heap);
+	free(data->dl.pos);
+	free(data->log.rings);
+	free(data->log.events);
 }
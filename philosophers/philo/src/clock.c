@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   clock.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:47:25 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 02:19:32 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+g_clock: the clock source chosen at startup. Written once by clock_init()
+before any thread is created, read-only afterwards. Zero-initialized, it
+selects CLOCK_MONOTONIC, so get_time() works even before clock_init().
+*/
+static t_clock	g_clock;
+
+/*
+mono_ns(): Reads CLOCK_MONOTONIC.
+
+Parameters: None.
+
+Return value: The monotonic time in nanoseconds.
+
+How it works:
+1. Calls clock_gettime, which glibc serves from the vDSO without entering
+	the kernel. Unlike gettimeofday, the clock never jumps when NTP or an
+	administrator steps the wall clock.
+*/
+u_int64_t	mono_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((u_int64_t)ts.tv_sec * 1000000000ULL + (u_int64_t)ts.tv_nsec);
+}
+
+/*
+clock_init(): Selects the clock source behind get_time().
+
+Parameters: src - The requested clock source.
+
+Return value: 0 if the requested source is in use, 1 if it is unavailable
+				and CLOCK_MONOTONIC is used instead.
+
+How it works:
+1. CLOCK_SRC_MONO and CLOCK_SRC_VIRTUAL need no setup.
+2. CLOCK_SRC_TSC is only used if the CPU has an invariant TSC. It is then
+	calibrated against CLOCK_MONOTONIC, so both share the same time base.
+*/
+int	clock_init(t_clock_src src)
+{
+	g_clock.src = src;
+	if (src != CLOCK_SRC_TSC)
+		return (0);
+	g_clock.src = CLOCK_SRC_MONO;
+	if (!tsc_available())
+		return (1);
+	tsc_calibrate(&g_clock);
+	g_clock.src = CLOCK_SRC_TSC;
+	return (0);
+}
+
+/*
+clock_ns(): Reads the selected clock source.
+
+Parameters: None.
+
+Return value: The current time in nanoseconds, on the CLOCK_MONOTONIC
+				time base.
+
+How it works:
+1. With the TSC source, scales the ticks elapsed since calibration by the
+	calibrated nanoseconds-per-tick (32.32 fixed point) and adds them to
+	the monotonic time taken at calibration.
+2. With --virtual-time, reads the simulated time.
+3. Otherwise, reads CLOCK_MONOTONIC.
+*/
+u_int64_t	clock_ns(void)
+{
+	unsigned __int128	ticks;
+
+	if (g_clock.src == CLOCK_SRC_VIRTUAL)
+		return (virtual_ns());
+	if (g_clock.src != CLOCK_SRC_TSC)
+		return (mono_ns());
+	ticks = tsc_read() - g_clock.tsc_base;
+	return (g_clock.ns_base + (u_int64_t)((ticks * g_clock.mult) >> 32));
+}
+
+/*
+get_time(): Gets the current time.
+
+Parameters: None.
+
+Return value: The current time in microseconds.
+
+How it works:
+1. Reads the selected clock source and converts it to microseconds.
+	Every timestamp in the simulation is kept in microseconds; only
+	the log writer converts to milliseconds.
+*/
+u_int64_t	get_time(void)
+{
+	return (clock_ns() / 1000);
+}
+
+/*
+clock_to_mono(): Converts a get_time() timestamp to an absolute
+					CLOCK_MONOTONIC time, for timed waits.
+
+Parameters: time - The timestamp, in microseconds.
+            ts - Where to store the CLOCK_MONOTONIC time.
+
+Return value: None.
+
+How it works:
+1. Adds the time left until the timestamp, on the selected clock, to the
+	current CLOCK_MONOTONIC time, so the result is right even when the
+	TSC clock has drifted from CLOCK_MONOTONIC.
+*/
+void	clock_to_mono(u_int64_t time, struct timespec *ts)
+{
+	u_int64_t	now;
+	u_int64_t	target;
+
+	now = clock_ns();
+	target = mono_ns();
+	if (time * 1000 > now)
+		target += time * 1000 - now;
+	ts->tv_sec = target / 1000000000;
+	ts->tv_nsec = target % 1000000000;
+}
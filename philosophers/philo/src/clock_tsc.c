@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   clock_tsc.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:47:25 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 01:47:25 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+#if defined(__x86_64__) || defined(__i386__)
+# include <x86intrin.h> //__rdtsc(): read the time-stamp counter
+# include <cpuid.h> //__get_cpuid(): query the invariant TSC flag
+
+/*
+tsc_read(): Reads the CPU's time-stamp counter.
+
+Parameters: None.
+
+Return value: The number of TSC ticks since reset.
+*/
+u_int64_t	tsc_read(void)
+{
+	return (__rdtsc());
+}
+
+/*
+tsc_available(): Checks if the TSC can be used as a clock.
+
+Parameters: None.
+
+Return value: 1 if the CPU reports an invariant TSC, 0 otherwise.
+
+How it works:
+1. Reads CPUID leaf 0x80000007. Bit 8 of EDX is set when the TSC ticks at
+	a constant rate in every P-, C- and T-state, so ticks convert to time
+	with one fixed factor on every core.
+*/
+int	tsc_available(void)
+{
+	unsigned int	regs[4];
+
+	if (!__get_cpuid(0x80000007, &regs[0], &regs[1], &regs[2], &regs[3]))
+		return (0);
+	return ((regs[3] >> 8) & 1);
+}
+#else
+
+/*
+tsc_read(): No TSC outside x86.
+*/
+u_int64_t	tsc_read(void)
+{
+	return (0);
+}
+
+/*
+tsc_available(): No TSC outside x86.
+*/
+int	tsc_available(void)
+{
+	return (0);
+}
+#endif
+
+/*
+tsc_calibrate(): Measures the TSC frequency against CLOCK_MONOTONIC.
+
+Parameters: clock - A pointer to the clock to calibrate.
+
+Return value: None.
+
+How it works:
+1. Reads both clocks, sleeps for TSC_CALIB_NS and reads both again.
+2. Stores nanoseconds per tick as a 32.32 fixed-point factor.
+3. Keeps the first pair of readings as the common origin, so TSC time
+	continues the CLOCK_MONOTONIC time base.
+*/
+void	tsc_calibrate(t_clock *clock)
+{
+	struct timespec	pause;
+	u_int64_t		ns_end;
+	u_int64_t		tsc_end;
+
+	pause.tv_sec = 0;
+	pause.tv_nsec = TSC_CALIB_NS;
+	clock->ns_base = mono_ns();
+	clock->tsc_base = tsc_read();
+	nanosleep(&pause, NULL);
+	ns_end = mono_ns();
+	tsc_end = tsc_read();
+	clock->mult = ((ns_end - clock->ns_base) << 32)
+		/ (tsc_end - clock->tsc_base);
+}
@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   clock_virtual.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:18:15 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 02:36:59 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+g_virtual_ns: the simulated time of --virtual-time. Only the simulation
+threads move it; the log writer reads it for its watermark.
+g_vclock: the virtual clock of the simulation the calling thread belongs
+to, g_virtual_ns unless virtual_bind() chose another one, as each --sweep
+runner does.
+*/
+static _Atomic u_int64_t					g_virtual_ns;
+static _Thread_local _Atomic u_int64_t	*g_vclock = &g_virtual_ns;
+
+/*
+virtual_ns(): Reads the virtual clock.
+
+Parameters: None.
+
+Return value: The simulated time in nanoseconds.
+*/
+u_int64_t	virtual_ns(void)
+{
+	return (atomic_load_explicit(g_vclock, memory_order_acquire));
+}
+
+/*
+virtual_advance(): Moves the virtual clock forward.
+
+Parameters: time - The new time, in microseconds.
+
+Return value: None.
+
+How it works:
+1. Stores the time if it is later than the current one: like a real
+	clock, the virtual one never goes back.
+*/
+void	virtual_advance(u_int64_t time)
+{
+	if (time * 1000 > virtual_ns())
+		atomic_store_explicit(g_vclock, time * 1000,
+			memory_order_release);
+}
+
+/*
+virtual_bind(): Makes the calling thread read and move another virtual
+				clock.
+
+Parameters: clock - A pointer to the clock, or NULL to keep the current one.
+
+Return value: None.
+*/
+void	virtual_bind(_Atomic u_int64_t *clock)
+{
+	if (clock)
+		g_vclock = clock;
+}
+
+/*
+virtual_clock(): Finds the virtual clock of the calling thread.
+
+Parameters: None.
+
+Return value: A pointer to the clock, for the threads the caller creates
+				to bind with virtual_bind().
+*/
+_Atomic u_int64_t	*virtual_clock(void)
+{
+	return (g_vclock);
+}
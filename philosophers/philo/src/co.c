@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   co.c                                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:28:25 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 02:30:53 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+g_co: the coroutine the scheduler thread is running, NULL while the
+scheduler itself runs and on every other thread.
+*/
+static _Thread_local t_co	*g_co;
+
+/*
+co_current(): Finds the coroutine running on this thread.
+
+Parameters: None.
+
+Return value: A pointer to the coroutine, or NULL outside of a coroutine.
+*/
+t_co	*co_current(void)
+{
+	return (g_co);
+}
+
+/*
+co_switch(): Runs a coroutine until it yields back to the scheduler.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            i - The index of the philosopher.
+
+Return value: None.
+
+How it works:
+1. Makes the coroutine current and swaps the scheduler's context for its
+	own. It comes back here when it parks, sleeps, or returns from
+	routine(), through uc_link.
+*/
+void	co_switch(t_data *data, int i)
+{
+	g_co = &data->pool.cos[i];
+	swapcontext(&data->pool.main, &g_co->ctx);
+	g_co = NULL;
+}
+
+/*
+co_park(): Yields from the running coroutine back to the scheduler.
+
+Parameters: None.
+
+Return value: None, once the scheduler runs the coroutine again.
+
+How it works:
+1. Saves the coroutine's context and resumes the scheduler's. Nothing
+	queues the coroutine: whoever parks must have made sure something will,
+	a timer or the neighbour dropping a fork.
+*/
+void	co_park(void)
+{
+	swapcontext(&g_co->ctx, &g_co->philo->data->pool.main);
+}
+
+/*
+co_sleep(): Sleeps in a coroutine, ft_usleep() with --coroutines.
+
+Parameters: sleep_time - The amount of time to sleep in microseconds.
+
+Return value: How late the coroutine was resumed, in microseconds.
+
+How it works:
+1. Files the coroutine in the scheduler's timer heap for the deadline.
+	If memory runs out, stops the simulation, as a worker does.
+2. Parks it: the scheduler queues it again once the deadline has passed.
+*/
+u_int64_t	co_sleep(u_int64_t sleep_time)
+{
+	t_co		*co;
+	t_data		*data;
+	u_int64_t	wake;
+
+	co = g_co;
+	data = co->philo->data;
+	wake = get_time() + sleep_time;
+	if (timer_push(&data->pool.workers[0], wake, co->philo->id - 1))
+	{
+		write(2, "philo: out of memory\n", 21);
+		push_keep_iter(data, 0);
+		return (0);
+	}
+	co_park();
+	return (get_time() - wake);
+}
+
+/*
+co_resume(): Makes a coroutine parked on a fork ready again.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            i - The index of the philosopher.
+
+Return value: None.
+
+How it works:
+1. Queues it on the scheduler. It runs on the same thread as the
+	coroutine dropping the fork, so nobody has to be woken.
+*/
+void	co_resume(t_data *data, int i)
+{
+	if (queue_push(&data->pool.workers[0], i))
+		push_keep_iter(data, 0);
+}
@@ -0,0 +1,162 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   co_sched.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:28:25 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 04:26:26 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+co_entry(): The first function of every coroutine.
+
+Parameters: None.
+
+Return value: None. Returning resumes the scheduler, through uc_link.
+
+How it works:
+1. Runs the philosopher's routine(), as a thread would.
+*/
+static void	co_entry(void)
+{
+	routine(co_current()->philo);
+}
+
+/*
+co_stacks(): Reserves the stacks of the coroutines, each above a guard page.
+
+Parameters: p - A pointer to the worker pool.
+            n - The number of coroutines.
+            page - The size of a page.
+
+Return value: 0 on success, 1 if the stacks cannot be reserved.
+
+How it works:
+1. Reserves every stack at once with MAP_NORESERVE: a coroutine only
+	costs the pages its stack actually touches.
+2. Makes the page below each stack PROT_NONE, so a coroutine overflowing
+	its stack faults instead of writing over its neighbour's. Every guard
+	splits the mapping: once the kernel's limit on mappings is reached,
+	warns and leaves the remaining stacks unguarded.
+*/
+static int	co_stacks(t_pool *p, int n, size_t page)
+{
+	int	i;
+
+	p->stacks_len = (size_t)n * (CO_STACK_SIZE + page);
+	p->stacks = mmap(NULL, p->stacks_len, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	if (p->stacks == MAP_FAILED)
+		return (1);
+	i = -1;
+	while (++i < n)
+	{
+		if (mprotect(p->stacks + (size_t)i * (CO_STACK_SIZE + page), page,
+				PROT_NONE))
+		{
+			write(2, "philo: too many coroutines to guard every stack\n",
+				48);
+			break ;
+		}
+	}
+	return (0);
+}
+
+/*
+co_init(): Builds one coroutine per philosopher, on top of the worker pool.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: 0 on success, 1 if memory cannot be allocated.
+
+How it works:
+1. Makes co_resume() the way a dropped fork resumes a philosopher.
+2. Reserves the stacks and their guard pages with co_stacks.
+3. Prepares each context to start in co_entry() on its own stack, and to
+	return to the scheduler. pool_init() has queued every philosopher on
+	worker 0 already.
+*/
+int	co_init(t_data *data)
+{
+	t_pool	*p;
+	t_co	*co;
+	size_t	page;
+	int		i;
+
+	p = &data->pool;
+	p->resume = &co_resume;
+	p->cos = malloc(sizeof(t_co) * data->conf.n_philos);
+	page = sysconf(_SC_PAGESIZE);
+	if (!p->cos || co_stacks(p, data->conf.n_philos, page))
+		return (1);
+	i = -1;
+	while (++i < data->conf.n_philos)
+	{
+		co = &p->cos[i];
+		co->philo = &data->philo[i];
+		getcontext(&co->ctx);
+		co->ctx.uc_stack.ss_sp = p->stacks + (size_t)i * (CO_STACK_SIZE
+				+ page) + page;
+		co->ctx.uc_stack.ss_size = CO_STACK_SIZE;
+		co->ctx.uc_link = &p->main;
+		makecontext(&co->ctx, &co_entry, 0);
+	}
+	return (0);
+}
+
+/*
+co_routine(): The main routine of the scheduler thread.
+
+Parameters: data_p - A void pointer to the data structure.
+			This is cast to a t_data pointer within the function.
+
+Return value: NULL.
+
+How it works:
+1. Binds the thread to worker 0's log ring, which every coroutine shares.
+2. Until the simulation stops, queues the coroutines whose sleep is over,
+	then switches to the next ready one, else sleeps until the earliest
+	timer like an idle worker. A coroutine still parked when the
+	simulation stops is simply never resumed.
+*/
+void	*co_routine(void *data_p)
+{
+	t_data		*data;
+	t_worker	*w;
+	int			i;
+
+	data = (t_data *)data_p;
+	w = &data->pool.workers[0];
+	log_attach(data, 0);
+	while (pull_keep_iter(data))
+	{
+		if (timer_expire(w))
+			push_keep_iter(data, 0);
+		if (queue_pop(w, &i))
+			co_switch(data, i);
+		else
+			worker_idle(w);
+	}
+	return (NULL);
+}
+
+/*
+co_free(): Frees the coroutines and their stacks.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: None.
+*/
+void	co_free(t_data *data)
+{
+	if (data->pool.stacks && data->pool.stacks != MAP_FAILED)
+		munmap(data->pool.stacks, data->pool.stacks_len);
+	free(data->pool.cos);
+}
@@ -6,7 +6,7 @@
 /*   By: pmelis <pmelis@student.42wolfsburg.de>     +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2023/12/04 20:30:54 by pmelis            #+#    #+#             */
-/*   Updated: 2023/12/09 19:06:28 by pmelis           ###   ########.fr       */
+/*   Updated: 2026/10/18 04:24:17 by pmelis           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -22,7 +22,9 @@ Return value: 0 if the forks are initialized successfully.
 
 How it works: 
 1. Retrieves the philosophers array from the data structure.
-2. Initializes a mutex for each fork using the pthread_mutex_init function.
+2. Initializes a mutex for each fork using the sync_init function, which
+	makes it process-shared with --processes, and sets the state of the
+	other locks to free.
 3. Sets the left and right forks for each philosopher.
 */
 int	fork_init(t_data *data)
@@ -32,15 +34,21 @@ int	fork_init(t_data *data)
 
 	i = -1;
 	philo = data->philo;
-	while (++i < data->n_philos)
-		pthread_mutex_init(&data->forks[i], NULL);
+	while (++i < data->conf.n_philos)
+	{
+		sync_init(data, &fork_at(data, i)->mu, NULL);
+		atomic_init(&fork_at(data, i)->state, FORK_FREE);
+		atomic_init(&fork_at(data, i)->ticket, 0);
+		atomic_init(&fork_at(data, i)->tail, NULL);
+		atomic_init(&fork_at(data, i)->until, 0);
+	}
 	i = 0;
-	philo[0].left_f = &data->forks[0];
-	philo[0].right_f = &data->forks[data->n_philos - 1];
-	while (++i < data->n_philos)
+	philo[0].left_f = fork_at(data, 0);
+	philo[0].right_f = fork_at(data, data->conf.n_philos - 1);
+	while (++i < data->conf.n_philos)
 	{
-		philo[i].left_f = &data->forks[i];
-		philo[i].right_f = &data->forks[i - 1];
+		philo[i].left_f = fork_at(data, i);
+		philo[i].right_f = fork_at(data, i - 1);
 	}
 	return (0);
 }
@@ -55,9 +63,12 @@ Return value: 0 if the philosophers are initialized successfully.
 
 How it works: 
 1. Retrieves the philosophers array from the data structure.
-2. For each philosopher, sets the data, id, number of meals, and state.
-3. Initializes several mutexes for synchronizing access to shared data.
-4. Updates the last meal time for each philosopher.
+2. For each philosopher, sets the data, id and hot data pointer, and
+	zeroes its time spent waiting for forks.
+3. Zeroes the number of meals and packs the current time and the IDLE
+	state into the meal word.
+4. Builds the deadline heap from the last meal times, and empties the
+	log rings.
 */
 int	philo_init(t_data *data)
 {
@@ -66,22 +77,25 @@ int	philo_init(t_data *data)
 
 	i = -1;
 	philo = data->philo;
-	while (++i < data->n_philos)
+	while (++i < data->conf.n_philos)
 	{
 		philo[i].data = data;
 		philo[i].id = i + 1;
-		philo[i].n_meals = 0;
-		philo[i].state = IDLE;
-		pthread_mutex_init(&philo[i].state_mu, NULL);
-		pthread_mutex_init(&philo[i].n_meals_mu, NULL);
-		pthread_mutex_init(&philo[i].last_meal_mu, NULL);
-		update_last_meal(&philo[i]);
+		philo[i].hot = hot_at(data, i);
+		stats_init(philo[i].hot);
+		philo[i].noticed_us = 0;
+		atomic_init(&philo[i].hot->n_meals, 0);
+		atomic_init(&philo[i].hot->meal_word,
+			pack_meal_word(get_time(), IDLE));
 	}
+	dl_init(&data->dl, data, 0, data->conf.n_philos);
+	log_init(data);
 	return (0);
 }
 
 /*
-data_malloc(): Allocates memory for the philosophers and their threads.
+data_malloc(): Allocates memory for the philosophers, their forks, their
+				threads, their deadlines and the log rings.
 
 Parameters: data - A pointer to the data structure that holds
 			the simulation data.
@@ -89,26 +103,38 @@ Parameters: data - A pointer to the data structure that holds
 Return value: 0 if the memory is allocated successfully, 2 if there's an error.
 
 How it works: 
-1. Allocates memory for the philosophers array using the malloc function.
-2. If the memory allocation fails, returns 2.
-3. Allocates memory for the forks array using the malloc function.
-4. If the memory allocation fails, frees the philosophers array and returns 2.
-5. Allocates memory for the philosopher threads array using the malloc function.
-6. If the memory allocation fails, frees the philosophers and forks arrays
-	and returns 2.
-7. If the memory is allocated successfully for all arrays, returns 0.
+1. Computes the strides of the hot philosopher data and of the forks for
+	the layout chosen in the options.
+2. Allocates the cold philosophers array, the hot philosopher data, the
+	forks, the philosopher threads, the deadline heap, the log rings and
+	their events with data_alloc, from the shared mapping with --processes.
+3. If any allocation fails, frees all of them and returns 2.
+4. If the memory is allocated successfully for all arrays, returns 0.
 */
 int	data_malloc(t_data *data)
 {
-	data->philo = malloc(sizeof(t_philo) * data->n_philos);
-	if (data->philo == NULL)
+	int	n;
+
+	n = data->conf.n_philos;
+	data->hot_stride = layout_stride(data, sizeof(t_philo_hot));
+	data->fork_stride = layout_stride(data, sizeof(t_fork));
+	data->philo = data_alloc(data, sizeof(t_philo) * n, 0);
+	data->hot = layout_alloc(data, data->hot_stride);
+	data->forks = layout_alloc(data, data->fork_stride);
+	data->philo_th = data_alloc(data, sizeof(pthread_t) * n, 0);
+	data->dl.heap = data_alloc(data, sizeof(t_dl_node) * n, 0);
+	data->dl.pos = data_alloc(data, sizeof(int) * n, 0);
+	data->log.rings = data_alloc(data,
+			sizeof(t_ring) * data->log.n_rings, 1);
+	data->log.events = data_alloc(data, sizeof(t_log_event)
+			* data->log.n_rings * data->log.ring_size, 0);
+	if (!data->philo || !data->hot || !data->forks || !data->philo_th
+		|| !data->dl.heap || !data->dl.pos || !data->log.rings
+		|| !data->log.events)
+	{
+		free_arrays(data);
 		return (2);
-	data->forks = malloc(sizeof(pthread_mutex_t) * data->n_philos);
-	if (data->forks == NULL)
-		return (free(data->philo), 2);
-	data->philo_th = malloc(sizeof(pthread_t) * data->n_philos);
-	if (data->philo_th == NULL)
-		return (free(data->philo), free(data->forks), 2);
+	}
 	return (0);
 }
 
@@ -125,29 +151,44 @@ Return value:	0 if the data structure is initialized successfully,
 
 How it works: 
 1. Sets the keep_iter field to 1.
-2. Sets the number of philosophers, time to die, time to eat, and time to sleep 
-	from the command-line arguments.
+2. Fills the config block with the number of philosophers, time to die,
+	time to eat, and time to sleep from the command-line arguments,
+	converting the times from milliseconds to microseconds.
 3. If the number of meals is specified in the command-line arguments, sets it.
-4. Initializes several mutexes for synchronizing access to shared data.
-5. Calls the data_malloc function to allocate memory for the philosophers
+4. Sets the number of pool workers from the options, 0 for one thread per
+	philosopher, at least 1 for the virtual-time simulation and exactly 1,
+	the scheduler, with --coroutines, and sizes the log:
+	one ring per producer thread, that is per philosopher or per worker,
+	plus one for the death monitor. Workers log for many philosophers, so
+	their rings are larger.
+5. Initializes the satisfied counter.
+6. Calls the data_malloc function to allocate memory for the philosophers
 	and their threads.
 */
 int	data_init(t_data *data, int ac, char **av)
 {
-	data->keep_iter = 1;
-	data->n_philos = ft_atoi(av[1]);
-	data->ms_todie = (u_int64_t) ft_atoi(av[2]);
-	data->ms_toeat = (u_int64_t) ft_atoi(av[3]);
-	data->ms_tosleep = (u_int64_t) ft_atoi(av[4]);
-	data->n_meals = -1;
+	atomic_init(&data->keep_iter, 1);
+	data->conf.n_philos = ft_atoi(av[1]);
+	data->conf.us_todie = (u_int64_t) ft_atoi(av[2]) * 1000;
+	data->conf.us_toeat = (u_int64_t) ft_atoi(av[3]) * 1000;
+	data->conf.us_tosleep = (u_int64_t) ft_atoi(av[4]) * 1000;
+	data->conf.n_meals = -1;
 	if (ac == 6)
-		data->n_meals = ft_atoi(av[5]);
-	pthread_mutex_init(&data->ms_toeat_mu, NULL);
-	pthread_mutex_init(&data->ms_tosleep_mu, NULL);
-	pthread_mutex_init(&data->ms_todie_mu, NULL);
-	pthread_mutex_init(&data->print_mu, NULL);
-	pthread_mutex_init(&data->n_philos_mu, NULL);
-	pthread_mutex_init(&data->keep_iter_mu, NULL);
-	pthread_mutex_init(&data->start_time_mu, NULL);
+		data->conf.n_meals = ft_atoi(av[5]);
+	data->conf.start_time = 0;
+	data->conf.n_workers = (int)data->opts.workers;
+	if ((data->opts.clock == CLOCK_SRC_VIRTUAL && !data->conf.n_workers)
+		|| data->opts.coroutines)
+		data->conf.n_workers = 1;
+	data->log.n_rings = data->conf.n_philos + 1;
+	data->log.ring_size = LOG_RING_SIZE;
+	if (data->conf.n_workers)
+	{
+		data->log.n_rings = data->conf.n_workers + 1;
+		data->log.ring_size = POOL_RING_SIZE;
+	}
+	memset(&data->pool, 0, sizeof(t_pool));
+	memset(&data->arb, 0, sizeof(t_arbiter));
+	full_init(data);
 	return (data_malloc(data));
 }
@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   deadline.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:51:11 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:41:54 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+dl_swap(): Swaps two nodes of the deadline heap and their positions.
+
+Parameters: dl - A pointer to the deadline heap.
+            a - The index of the first node.
+            b - The index of the second node.
+
+Return value: None.
+*/
+static void	dl_swap(t_deadlines *dl, int a, int b)
+{
+	t_dl_node	tmp;
+
+	tmp = dl->heap[a];
+	dl->heap[a] = dl->heap[b];
+	dl->heap[b] = tmp;
+	dl->pos[dl->heap[a].philo] = a;
+	dl->pos[dl->heap[b].philo] = b;
+}
+
+/*
+dl_sift_up(): Moves a node towards the root while its deadline is earlier
+				than its parent's.
+
+Parameters: dl - A pointer to the deadline heap.
+            i - The index of the node.
+
+Return value: None.
+*/
+static void	dl_sift_up(t_deadlines *dl, int i)
+{
+	while (i > 0 && dl->heap[i].key < dl->heap[(i - 1) / 2].key)
+	{
+		dl_swap(dl, i, (i - 1) / 2);
+		i = (i - 1) / 2;
+	}
+}
+
+/*
+dl_sift_down(): Moves a node towards the leaves while one of its children
+				has an earlier deadline.
+
+Parameters: dl - A pointer to the deadline heap.
+            i - The index of the node.
+
+Return value: None.
+*/
+static void	dl_sift_down(t_deadlines *dl, int i)
+{
+	int	min;
+
+	while (1)
+	{
+		min = i;
+		if (2 * i + 1 < dl->n && dl->heap[2 * i + 1].key < dl->heap[min].key)
+			min = 2 * i + 1;
+		if (2 * i + 2 < dl->n && dl->heap[2 * i + 2].key < dl->heap[min].key)
+			min = 2 * i + 2;
+		if (min == i)
+			return ;
+		dl_swap(dl, i, min);
+		i = min;
+	}
+}
+
+/*
+dl_update(): Changes the deadline of a philosopher.
+
+Parameters: dl - A pointer to the deadline heap.
+            philo - The index of the philosopher.
+            key - The new deadline, in microseconds.
+
+Return value: None.
+
+How it works:
+1. Locks the heap, stores the new deadline and restores the heap order.
+	Deadlines normally only move later, so the node sinks.
+*/
+void	dl_update(t_deadlines *dl, int philo, u_int64_t key)
+{
+	pthread_mutex_lock(&dl->mu);
+	dl->heap[dl->pos[philo]].key = key;
+	dl_sift_down(dl, dl->pos[philo]);
+	dl_sift_up(dl, dl->pos[philo]);
+	pthread_mutex_unlock(&dl->mu);
+}
+
+/*
+dl_init(): Builds a deadline heap from the philosophers' last meals.
+
+Parameters: dl - A pointer to the deadline heap. Its heap and pos arrays
+				are set already.
+            data - A pointer to the data structure that holds
+				the simulation data.
+            lo - The index of the first philosopher of the heap.
+            hi - The index past its last philosopher.
+
+Return value: None.
+
+How it works:
+1. Initializes the heap mutex, and a condition variable that times out on
+	CLOCK_MONOTONIC so the monitor's waits are immune to clock steps, both
+	process-shared with --processes, with sync_init.
+2. Inserts philosophers lo to hi - 1 with a deadline of last meal + time
+	to die, and points each of them to the heap.
+*/
+void	dl_init(t_deadlines *dl, t_data *data, int lo, int hi)
+{
+	sync_init(data, &dl->mu, &dl->cv);
+	atomic_init(&dl->lag_us, 0);
+	dl->n = 0;
+	while (lo + dl->n < hi)
+	{
+		dl->heap[dl->n].philo = lo + dl->n;
+		dl->heap[dl->n].key = pull_last_meal(&data->philo[lo + dl->n])
+			+ data->conf.us_todie;
+		dl->pos[lo + dl->n] = dl->n;
+		data->philo[lo + dl->n].dl = dl;
+		dl_sift_up(dl, dl->n++);
+	}
+}
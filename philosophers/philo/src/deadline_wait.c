@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   deadline_wait.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:51:12 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:41:54 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+dl_lag(): Publishes how late the monitor woke up, for --metrics.
+
+Parameters: dl - A pointer to the deadline heap.
+            target - The time the monitor slept until.
+
+Return value: None.
+
+How it works:
+1. Stores the time since the target in lag_us, if it has passed: a wake-up
+	before it was a broadcast, not a timeout, and says nothing about lag.
+*/
+static void	dl_lag(t_deadlines *dl, u_int64_t target)
+{
+	u_int64_t	now;
+
+	now = get_time();
+	if (now >= target)
+		atomic_store_explicit(&dl->lag_us, now - target, memory_order_relaxed);
+}
+
+/*
+dl_next_due(): Blocks until a philosopher's deadline has passed.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: The index of a philosopher whose deadline has passed, or -1
+				once the simulation is stopping.
+
+How it works:
+1. Looks at the earliest deadline at the root of the heap.
+2. If it has passed, returns its philosopher.
+3. Otherwise, sleeps on the heap's condition variable until that deadline,
+	and publishes how late it woke up with dl_lag.
+	Philosophers only push deadlines later, so nothing can become due
+	earlier; push_keep_iter() broadcasts to wake the monitor on stop.
+*/
+int	dl_next_due(t_data *data)
+{
+	struct timespec	ts;
+	t_dl_node		top;
+	int				due;
+
+	due = -1;
+	pthread_mutex_lock(&data->dl.mu);
+	while (due < 0 && pull_keep_iter(data))
+	{
+		top = data->dl.heap[0];
+		if (get_time() > top.key)
+			due = top.philo;
+		else
+		{
+			clock_to_mono(top.key + 1, &ts);
+			pthread_cond_timedwait(&data->dl.cv, &data->dl.mu, &ts);
+			dl_lag(&data->dl, top.key + 1);
+		}
+	}
+	pthread_mutex_unlock(&data->dl.mu);
+	return (due);
+}
+
+/*
+dl_postpone(): Reschedules a philosopher that was due but is not dead.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            i - The index of the philosopher.
+
+Return value: None.
+
+How it works:
+1. If the philosopher ate since, its deadline is last meal + time to die.
+2. If it is still past its deadline, it is eating; checks it again in
+	DL_RECHECK_US, since it may die as soon as it stops eating.
+*/
+void	dl_postpone(t_data *data, int i)
+{
+	u_int64_t	key;
+
+	key = pull_last_meal(&data->philo[i]) + pull_death_time(data);
+	if (key < get_time() + DL_RECHECK_US)
+		key = get_time() + DL_RECHECK_US;
+	dl_update(data->philo[i].dl, i, key);
+}
+
+/*
+dl_destroy(): Destroys the deadline heap's mutex and condition variable.
+
+Parameters: dl - A pointer to the deadline heap.
+
+Return value: None.
+*/
+void	dl_destroy(t_deadlines *dl)
+{
+	pthread_mutex_destroy(&dl->mu);
+	pthread_cond_destroy(&dl->cv);
+}
@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   death_report.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:26:02 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 04:22:21 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+g_death: the death-detection histograms of --death-report. report is
+written once by death_init() before any thread is created; the
+histograms add up every simulation of the process, so a --sweep reports
+over all its runs.
+*/
+static t_death_stats	g_death;
+
+/*
+death_init(): Turns the death-detection histograms on or off.
+
+Parameters: report - 1 to record and print them.
+
+Return value: None.
+*/
+void	death_init(int report)
+{
+	g_death.report = report;
+}
+
+/*
+death_note(): Records how late a death was written, or how late the
+				death monitor found a philosopher alive.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            i - The index of the philosopher.
+            died - 1 if the log writer just wrote its death to stdout, 0
+				if the monitor found it alive.
+
+Return value: None.
+
+How it works:
+1. Computes the true deadline, last meal + time to die. A death leaves the
+	last meal in the meal word.
+2. A philosopher found alive before its deadline ate since it came due,
+	and is no near-miss. One found past it is eating: counts it as a
+	near-miss once per deadline, not at every recheck of its meal.
+3. Records the time since the deadline in the matching histogram.
+*/
+void	death_note(t_data *data, int i, int died)
+{
+	t_philo		*philo;
+	u_int64_t	deadline;
+	u_int64_t	now;
+
+	if (!g_death.report)
+		return ;
+	philo = &data->philo[i];
+	now = get_time();
+	deadline = pull_last_meal(philo) + pull_death_time(data);
+	if (now < deadline || (!died && philo->noticed_us == deadline))
+		return ;
+	philo->noticed_us = deadline;
+	if (died)
+		hist_record(&g_death.died, now - deadline);
+	else
+		hist_record(&g_death.near, now - deadline);
+}
+
+/*
+death_print(): Prints one histogram's count and percentiles on stderr.
+
+Parameters: hist - A pointer to the histogram.
+            what - What it counts.
+            verb - What the monitor did at that time after the deadline.
+
+Return value: None.
+*/
+static void	death_print(t_hist *hist, char *what, char *verb)
+{
+	fprintf(stderr, "%s: %llu", what,
+		(unsigned long long)atomic_load(&hist->n));
+	if (atomic_load(&hist->n))
+		fprintf(stderr, ", %s after the deadline p50 %llu us, p99 %llu us, "
+			"max %llu us", verb, (unsigned long long)hist_pct(hist, 50),
+			(unsigned long long)hist_pct(hist, 99),
+			(unsigned long long)atomic_load(&hist->max));
+	fprintf(stderr, "\n");
+}
+
+/*
+death_report(): Prints the death-detection histograms on stderr, if
+				--death-report was given.
+
+Return value: None.
+
+How it works:
+1. Prints the deaths, then the near-misses, with death_print().
+2. Checks the longest time to report a death against DEATH_SLA_US.
+*/
+void	death_report(void)
+{
+	if (!g_death.report)
+		return ;
+	death_print(&g_death.died, "deaths", "printed");
+	death_print(&g_death.near, "near-misses", "noticed");
+	if (atomic_load(&g_death.died.n))
+	{
+		if (atomic_load(&g_death.died.max) <= DEATH_SLA_US)
+			fprintf(stderr, "every death printed within %d ms of its "
+				"deadline\n", DEATH_SLA_US / 1000);
+		else
+			fprintf(stderr, "a death printed more than %d ms after its "
+				"deadline\n", DEATH_SLA_US / 1000);
+	}
+}
@@ -0,0 +1,152 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   des.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:22:45 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 04:08:09 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+des_step(): Runs one step of a task and files it for what it waits for,
+			as task_run() does for the worker threads.
+
+Parameters: w - A pointer to the worker that owns the task.
+            i - The index of the philosopher.
+
+Return value: 0 on success, 1 if memory runs out.
+*/
+static int	des_step(t_worker *w, int i)
+{
+	u_int64_t	wake;
+	t_run		run;
+
+	wake = 0;
+	run = task_step(w->data, i, &wake);
+	if (run == RUN_READY)
+		return (queue_push(w, i));
+	if (run == RUN_TIMER)
+		return (timer_push(w, wake, i));
+	return (0);
+}
+
+/*
+des_death(): Checks a philosopher whose deadline has passed, as
+				all_alive_routine() does.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            i - The index of the philosopher.
+
+Return value: None.
+
+How it works:
+1. If the philosopher is dead, lowers the shared dead index to i with a
+	compare-and-swap loop: des_died() prints the lowest one once every
+	worker has checked its segment.
+2. Either way, reschedules it with dl_postpone: an eating one is checked
+	again later, a dead one is not looked at twice.
+*/
+static void	des_death(t_data *data, int i)
+{
+	int	cur;
+
+	if (philo_death(&data->philo[i]))
+	{
+		cur = atomic_load(&data->pool.dead);
+		while (i < cur
+			&& !atomic_compare_exchange_weak(&data->pool.dead, &cur, i))
+			;
+	}
+	dl_postpone(data, i);
+}
+
+/*
+des_drain(): Runs every task of a worker that is ready at the current
+				virtual time.
+
+Parameters: w - A pointer to the worker.
+
+Return value: None.
+
+How it works:
+1. Pops the run queue until it is empty. A task that is still ready is
+	queued again and runs in the same drain.
+2. If memory runs out, a task would be lost: stops the simulation.
+*/
+void	des_drain(t_worker *w)
+{
+	int	i;
+
+	while (queue_pop(w, &i))
+	{
+		if (des_step(w, i))
+		{
+			write(2, "philo: out of memory\n", 21);
+			push_keep_iter(w->data, 0);
+		}
+	}
+}
+
+/*
+des_due(): Moves the virtual clock to the next event and makes what is
+			due then ready.
+
+Parameters: w - A pointer to the worker.
+            now - The time of the next event, in microseconds.
+
+Return value: None.
+
+How it works:
+1. Moves the virtual clock. Every worker stores the same time.
+2. Checks the philosophers of the worker's segment that are past their
+	deadline first: a death wins a tie with a timer, as it is already due.
+	des_died() reports it after the next barrier.
+3. Queues the due timers of the worker.
+*/
+void	des_due(t_worker *w, u_int64_t now)
+{
+	virtual_advance(now);
+	while (w->dl.n > 0 && w->dl.heap[0].key < now && pull_keep_iter(w->data))
+		des_death(w->data, w->dl.heap[0].philo);
+	if (timer_expire(w))
+	{
+		write(2, "philo: out of memory\n", 21);
+		push_keep_iter(w->data, 0);
+	}
+}
+
+/*
+des_died(): Stops the simulation if a philosopher died at the current time.
+
+Parameters: w - A pointer to the worker.
+
+Return value: 1 if a philosopher died, 0 otherwise.
+
+How it works:
+1. Called after the barrier that ends des_due() on every worker. If
+	several philosophers died at once, the lowest index is the one printed,
+	whatever the segments.
+2. The worker owning it prints it and stops the simulation. Every worker
+	reads the same index, so they all stop.
+*/
+int	des_died(t_worker *w)
+{
+	int	i;
+
+	i = atomic_load(&w->data->pool.dead);
+	if (i == pull_n_philos(w->data))
+		return (0);
+	if (pool_owner(w->data, i) == w->id && pull_keep_iter(w->data))
+	{
+		print_changestate(w->data, w->data->philo[i].id, MSG_DIED);
+		push_keep_iter(w->data, 0);
+		notify_all(w->data);
+	}
+	return (1);
+}
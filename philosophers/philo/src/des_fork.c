@@ -0,0 +1,186 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   des_fork.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:59:06 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 04:28:52 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+des_pend(): Files a fork for the next grant phase of the worker owning it.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            f - The index of the fork.
+
+Return value: None.
+
+How it works:
+1. Fork f belongs to the worker of philosopher f. Tasks of two workers
+	can file the same fork, so each claims its slot with a fetch-and-add.
+2. A fork is filed at most three times a round: a request from each
+	neighbour and a drop, so p_cap is never reached. A fork filed twice
+	is looked at twice, which grants it once.
+*/
+static void	des_pend(t_data *data, int f)
+{
+	t_worker	*w;
+	int			k;
+
+	w = &data->pool.workers[pool_owner(data, f)];
+	k = atomic_fetch_add(&w->p_len, 1);
+	if (k < w->p_cap)
+		w->pend[k] = f;
+}
+
+/*
+des_take(): Takes a fork in virtual time, pfork_take() with --virtual-time.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            i - The index of the philosopher taking the fork.
+            fork - A pointer to the fork.
+
+Return value: 1 if the fork was granted to the philosopher, 0 otherwise:
+				the request is filed and the task must park.
+
+How it works:
+1. Fork f is the left fork of philosopher f and the right fork of
+	philosopher f + 1, as fork_init() sets them: their requests are the
+	DES_WANT_LEFT and DES_WANT_RIGHT bits of want[f], and the grants the
+	same bits shifted by two.
+2. A granted fork is already held: clears the grant and returns 1.
+3. Otherwise, sets the request bit and files the fork for des_grant().
+	The fork is never taken during a drain, so which neighbour gets it
+	does not depend on which worker runs first.
+*/
+int	des_take(t_data *data, int i, t_fork *fork)
+{
+	int	f;
+	int	bit;
+
+	f = i;
+	bit = DES_WANT_LEFT;
+	if (fork != data->philo[i].left_f)
+	{
+		f = (i + pull_n_philos(data) - 1) % pull_n_philos(data);
+		bit = DES_WANT_RIGHT;
+	}
+	if (atomic_load(&data->pool.want[f]) & (bit << 2))
+	{
+		atomic_fetch_and(&data->pool.want[f], ~(bit << 2));
+		return (1);
+	}
+	atomic_fetch_or(&data->pool.want[f], bit);
+	des_pend(data, f);
+	return (0);
+}
+
+/*
+des_drop(): Drops a fork in virtual time, pfork_drop() with --virtual-time.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            i - The index of the philosopher dropping the fork.
+            fork - A pointer to the fork.
+
+Return value: None.
+
+How it works:
+1. Sets the fork free.
+2. If a neighbour asked for it, files it for des_grant(). A request made
+	in the same drain files the fork itself, so either way it is seen.
+*/
+void	des_drop(t_data *data, int i, t_fork *fork)
+{
+	int	f;
+
+	f = i;
+	if (fork != data->philo[i].left_f)
+		f = (i + pull_n_philos(data) - 1) % pull_n_philos(data);
+	atomic_store(&fork->state, FORK_FREE);
+	if (atomic_load(&data->pool.want[f]) & DES_WANT_BOTH)
+		des_pend(data, f);
+}
+
+/*
+des_winner(): Chooses which neighbour gets a fork both asked for.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            f - The index of the fork.
+            want - The request bits of the fork.
+
+Return value: The request bit of the winner.
+
+How it works:
+1. The one that ate longest ago wins, as it dies first. On a tie, the
+	lower index wins. Both only depend on the virtual time, not on the
+	worker count.
+*/
+static int	des_winner(t_data *data, int f, int want)
+{
+	int			right;
+	u_int64_t	left_meal;
+	u_int64_t	right_meal;
+
+	if (want != DES_WANT_BOTH)
+		return (want);
+	right = (f + 1) % pull_n_philos(data);
+	left_meal = pull_last_meal(&data->philo[f]);
+	right_meal = pull_last_meal(&data->philo[right]);
+	if (left_meal < right_meal || (left_meal == right_meal && f < right))
+		return (DES_WANT_LEFT);
+	return (DES_WANT_RIGHT);
+}
+
+/*
+des_grant(): Hands the forks filed during a drain to their neighbours.
+
+Parameters: w - A pointer to the worker.
+
+Return value: None.
+
+How it works:
+1. Called between two barriers, when no task runs: the worker is the only
+	one to touch the state and the bits of the forks it owns.
+2. Each filed fork that is free and asked for goes to the neighbour that
+	ate longest ago, the lower index on a tie, as des_winner() decides:
+	takes it for the winner, turns its request into a grant, and queues
+	its task on the worker that owns it. The first to ask does not win,
+	as that would depend on which worker drained first.
+3. Flags the round if a fork was granted, so every worker drains once
+	more before time moves on.
+*/
+void	des_grant(t_worker *w)
+{
+	t_fork	*fork;
+	int		f;
+	int		want;
+	int		bit;
+	int		k;
+
+	k = -1;
+	while (++k < atomic_load(&w->p_len) && k < w->p_cap)
+	{
+		f = w->pend[k];
+		fork = w->data->philo[f].left_f;
+		want = atomic_load(&w->data->pool.want[f]);
+		if (!(want & DES_WANT_BOTH) || atomic_load(&fork->state) != FORK_FREE)
+			continue ;
+		bit = des_winner(w->data, f, want & DES_WANT_BOTH);
+		atomic_store(&fork->state, FORK_TAKEN);
+		atomic_store(&w->data->pool.want[f], (want & ~bit) | (bit << 2));
+		f = (f + (bit == DES_WANT_RIGHT)) % pull_n_philos(w->data);
+		if (queue_push(&w->data->pool.workers[pool_owner(w->data, f)], f))
+			push_keep_iter(w->data, 0);
+		atomic_store(&w->data->pool.granted[w->round % 3], 1);
+	}
+	atomic_store(&w->p_len, 0);
+}
@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   des_init.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:59:06 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:59:06 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+des_init(): Allocates the fork requests of the virtual-time simulation.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: 0 on success, 1 if memory cannot be allocated.
+
+How it works:
+1. Allocates the request and grant bits of every fork (want), and for
+	every worker the list of forks filed for its grant phase (pend). A
+	worker owns one fork per philosopher of its segment, filed three times
+	a round at most.
+2. No philosopher died yet: dead is the philosopher count.
+*/
+int	des_init(t_data *data)
+{
+	t_worker	*w;
+	int			k;
+	int			cap;
+	int			err;
+
+	data->pool.want = calloc(data->conf.n_philos, sizeof(atomic_int));
+	err = !data->pool.want;
+	cap = 3 * (data->conf.n_philos / data->conf.n_workers + 1);
+	k = -1;
+	while (++k < data->conf.n_workers)
+	{
+		w = &data->pool.workers[k];
+		w->pend = malloc(sizeof(int) * cap);
+		w->p_cap = cap;
+		err |= !w->pend;
+	}
+	atomic_init(&data->pool.dead, data->conf.n_philos);
+	return (err);
+}
+
+/*
+des_segments(): Gives every worker the deadline heap of its segment.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: None.
+
+How it works:
+1. Each worker's heap is the slice of the global heap array for its
+	segment, and shares the global pos array, whose entries for the
+	segment are only touched by it. The death monitor does not run in
+	virtual time, so the global heap is not used.
+2. Clears the shared round flags and minima.
+*/
+void	des_segments(t_data *data)
+{
+	t_worker	*w;
+	int			k;
+	int			lo;
+	int			hi;
+
+	k = -1;
+	hi = 0;
+	while (++k < data->conf.n_workers)
+	{
+		w = &data->pool.workers[k];
+		lo = hi;
+		while (hi < data->conf.n_philos && pool_owner(data, hi) == k)
+			hi++;
+		w->dl.heap = &data->dl.heap[lo];
+		w->dl.pos = data->dl.pos;
+		dl_init(&w->dl, data, lo, hi);
+	}
+	k = -1;
+	while (++k < 3)
+	{
+		atomic_init(&data->pool.granted[k], 0);
+		atomic_init(&data->pool.next[k], DES_NEVER);
+	}
+}
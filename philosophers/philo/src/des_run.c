@@ -0,0 +1,174 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   des_run.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:22:45 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 04:28:52 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+des_propose(): Offers the time of a worker's next event for the next step.
+
+Parameters: w - A pointer to the worker.
+            next - The shared minimum of the workers' next events.
+
+Return value: None.
+
+How it works:
+1. The worker's next event is its earliest timer, or the first
+	microsecond past the earliest deadline of its segment, where
+	philo_death() sees that philosopher dead.
+2. Lowers next to it with a compare-and-swap loop.
+*/
+static void	des_propose(t_worker *w, _Atomic u_int64_t *next)
+{
+	u_int64_t	time;
+	u_int64_t	cur;
+
+	time = DES_NEVER;
+	if (w->n_timers > 0)
+		time = w->timers[0].key;
+	if (w->dl.n > 0 && w->dl.heap[0].key + 1 < time)
+		time = w->dl.heap[0].key + 1;
+	cur = atomic_load(next);
+	while (time < cur && !atomic_compare_exchange_weak(next, &cur, time))
+		;
+}
+
+/*
+des_sync(): Ends a round of a worker, in step with the others.
+
+Parameters: w - A pointer to the worker.
+            step - The number of time steps taken so far.
+
+Return value: 1 once the simulation is over, 0 otherwise.
+
+How it works:
+1. Called after a barrier, when every worker has drained its queue and
+	granted its forks. Nothing writes the stop flag, the satisfied counter
+	or the round's flag until the next barrier, so every worker takes the
+	same decision.
+2. Stops if the simulation was stopped or everyone is full.
+3. If a fork was granted, drains once more at the same time. Otherwise,
+	agrees on the earliest next event of all workers and moves on to it
+	with des_due, then stops if someone died then. The shared flags and
+	minima rotate over three slots, so a slot is reset a round before its
+	reuse.
+*/
+static int	des_sync(t_worker *w, int *step)
+{
+	t_pool	*pool;
+	int		granted;
+
+	pool = &w->data->pool;
+	if (!pull_keep_iter(w->data)
+		|| atomic_load(&w->data->full.n) >= pull_n_philos(w->data))
+		return (1);
+	granted = atomic_load(&pool->granted[w->round % 3]);
+	atomic_store(&pool->granted[(w->round + 2) % 3], 0);
+	w->round++;
+	if (granted)
+		return (0);
+	des_propose(w, &pool->next[*step % 3]);
+	atomic_store(&pool->next[(*step + 2) % 3], DES_NEVER);
+	pthread_barrier_wait(&pool->barrier);
+	des_due(w, atomic_load(&pool->next[(*step)++ % 3]));
+	pthread_barrier_wait(&pool->barrier);
+	return (des_died(w));
+}
+
+/*
+des_routine(): The routine of one worker of the virtual-time simulation.
+
+Parameters: worker_p - A void pointer to the worker.
+			This is cast to a t_worker pointer within the function.
+
+Return value: NULL.
+
+How it works:
+1. Binds the thread to the simulation's virtual clock and to its log ring,
+	and waits for des_run() to release the start mutex once the barrier
+	is set up.
+2. Drains its queue, then grants the forks asked for with des_grant, and
+	syncs with des_sync, each after a barrier, until the simulation is
+	over.
+*/
+void	*des_routine(void *worker_p)
+{
+	t_worker	*w;
+	int			step;
+
+	w = (t_worker *)worker_p;
+	virtual_bind(w->data->pool.vclock);
+	log_attach(w->data, w->id);
+	pthread_mutex_lock(&w->data->pool.start);
+	pthread_mutex_unlock(&w->data->pool.start);
+	step = 0;
+	while (1)
+	{
+		des_drain(w);
+		pthread_barrier_wait(&w->data->pool.barrier);
+		des_grant(w);
+		pthread_barrier_wait(&w->data->pool.barrier);
+		if (des_sync(w, &step))
+			break ;
+	}
+	return (NULL);
+}
+
+/*
+des_run(): Runs the whole simulation in virtual time.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: 0.
+
+How it works:
+1. Cuts the table into one segment per worker with des_segments(). Every
+	worker drives the tasks of its segment: task_step() is the state
+	machine of routine(), the timer heap and the run queue are the event
+	queue. Nothing ever sleeps. routine() itself cannot run here: it
+	blocks in ft_usleep() and on the fork mutexes, which an event queue
+	cannot resume. task_step() makes the same moves in the same order,
+	and asks for forks instead of taking them with take_both(), so the
+	grants stay independent of the worker count. Deaths go through
+	philo_death() against the deadline heap, as in the monitor.
+2. Starts the workers behind the start mutex, runs worker 0 on the
+	calling thread, and joins the others. If a thread cannot be created,
+	stops the simulation and runs with the workers that were.
+3. If the simulation stopped because everyone is full, stops it for
+	good, like all_full_routine().
+*/
+int	des_run(t_data *data)
+{
+	int	n;
+
+	des_segments(data);
+	pthread_mutex_init(&data->pool.start, NULL);
+	pthread_mutex_lock(&data->pool.start);
+	n = 1;
+	while (n < data->conf.n_workers && !pthread_create(
+			&data->pool.workers[n].th, NULL, &des_routine,
+			&data->pool.workers[n]))
+		n++;
+	if (n < data->conf.n_workers)
+		push_keep_iter(data, 0);
+	pthread_barrier_init(&data->pool.barrier, NULL, n);
+	pthread_mutex_unlock(&data->pool.start);
+	des_routine(&data->pool.workers[0]);
+	while (--n > 0)
+		pthread_join(data->pool.workers[n].th, NULL);
+	pthread_barrier_destroy(&data->pool.barrier);
+	pthread_mutex_destroy(&data->pool.start);
+	if (pull_keep_iter(data))
+		push_keep_iter(data, 0);
+	notify_all(data);
+	return (0);
+}
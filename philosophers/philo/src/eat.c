@@ -6,7 +6,7 @@
 /*   By: pmelis <pmelis@student.42wolfsburg.de>     +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2023/12/04 21:01:29 by pmelis            #+#    #+#             */
-/*   Updated: 2023/12/09 19:51:42 by pmelis           ###   ########.fr       */
+/*   Updated: 2026/10/18 04:24:17 by pmelis           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -20,15 +20,32 @@ Parameters: philo - A pointer to the philosopher structure.
 Return value: None.
 
 How it works:
-1. Locks the mutex associated with the last meal time data of the philosopher.
-2. Updates the last meal time data of the philosopher with the current time.
-3. Unlocks the mutex.
+1. Gets the current time.
+2. Swaps it into the meal word of the philosopher, keeping the state bits,
+	retrying if another thread changed the state in the meantime.
+3. If the philosopher is starting a meal, rather than its routine, keeps
+	the least time its previous deadline still had to go, for
+	stats_report().
+4. Moves the philosopher's deadline in its deadline heap.
 */
 void	update_last_meal(t_philo *philo)
 {
-	pthread_mutex_lock(&philo->last_meal_mu);
-	philo->last_meal = get_time();
-	pthread_mutex_unlock(&philo->last_meal_mu);
+	u_int64_t	now;
+	u_int64_t	old;
+	u_int64_t	new;
+	int64_t		slack;
+
+	now = get_time();
+	old = atomic_load_explicit(&philo->hot->meal_word, memory_order_acquire);
+	new = pack_meal_word(now, (t_state)(old >> STATE_SHIFT));
+	while (!atomic_compare_exchange_weak_explicit(&philo->hot->meal_word,
+			&old, new, memory_order_acq_rel, memory_order_acquire))
+		new = pack_meal_word(now, (t_state)(old >> STATE_SHIFT));
+	slack = (int64_t)((old & MEAL_MASK) + pull_death_time(philo->data) - now);
+	if ((old >> STATE_SHIFT) == EATING && slack < philo->hot->slack_min_us)
+		philo->hot->slack_min_us = slack;
+	dl_update(philo->dl, philo->id - 1,
+		now + pull_death_time(philo->data));
 }
 
 /*
@@ -39,13 +56,11 @@ Parameters: philo - A pointer to the philosopher structure.
 Return value: None.
 
 How it works:
-1. Unlocks the mutex associated with the left fork of the philosopher.
-2. Unlocks the mutex associated with the right fork of the philosopher.
+1. Drops both forks with the drop function of the --forks strategy.
 */
 void	drop_both(t_philo *philo)
 {
-	pthread_mutex_unlock(philo->left_f);
-	pthread_mutex_unlock(philo->right_f);
+	philo->data->arb.s->drop(philo);
 }
 
 /*
@@ -56,15 +71,22 @@ Parameters: philo - A pointer to the philosopher structure.
 Return value: None.
 
 How it works:
-1. Locks the mutex associated with the number of meals data of the philosopher.
-2. Increments the number of meals data of the philosopher.
-3. Unlocks the mutex.
+1. Adds how long the meal really lasted, since its last meal time, to
+	the philosopher's eat span, for stats_report().
+2. Atomically increments the number of meals of the philosopher.
+3. If that was its last required meal, counts it as satisfied with
+	full_signal, which wakes the completion monitor once everyone is.
 */
 void	update_n_meals(t_philo *philo)
 {
-	pthread_mutex_lock(&philo->n_meals_mu);
-	philo->n_meals++;
-	pthread_mutex_unlock(&philo->n_meals_mu);
+	int	n_meals;
+
+	stats_span(&philo->hot->stats[STAT_EAT],
+		get_time() - pull_last_meal(philo));
+	n_meals = atomic_fetch_add_explicit(&philo->hot->n_meals, 1,
+			memory_order_acq_rel) + 1;
+	if (n_meals == philo->data->conf.n_meals)
+		full_signal(philo->data);
 }
 
 /*
@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flock.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:00:11 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:09:01 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+parse_fork_lock(): Parses the value of --fork-lock.
+
+Parameters: val - The value of the option.
+            opts - A pointer to the options structure.
+
+Return value: 0 if the value names a lock, 1 otherwise.
+*/
+int	parse_fork_lock(char *val, t_opts *opts)
+{
+	if (!strcmp(val, "mutex"))
+		opts->fork_lock = LOCK_MUTEX;
+	else if (!strcmp(val, "ticket"))
+		opts->fork_lock = LOCK_TICKET;
+	else if (!strcmp(val, "mcs"))
+		opts->fork_lock = LOCK_MCS;
+	else if (!strcmp(val, "adaptive"))
+		opts->fork_lock = LOCK_ADAPTIVE;
+	else if (!strcmp(val, "handoff"))
+		opts->fork_lock = LOCK_HANDOFF;
+	else
+		return (1);
+	return (0);
+}
+
+/*
+futex_wait(): Sleeps in the kernel as long as a 32-bit word holds a value.
+
+Parameters: addr - The address of the word.
+            val - The value it is expected to hold.
+
+Return value: None. It may return early; callers check the word again.
+*/
+void	futex_wait(void *addr, unsigned int val)
+{
+	syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, val, NULL, NULL, 0);
+}
+
+/*
+futex_wake(): Wakes threads sleeping on a word in futex_wait().
+
+Parameters: addr - The address of the word.
+            n - The number of threads to wake at most.
+
+Return value: None.
+*/
+void	futex_wake(void *addr, int n)
+{
+	syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, n, NULL, NULL, 0);
+}
+
+/*
+ticket_lock(): Takes a fork with a ticket lock.
+
+Parameters: fork - A pointer to the fork.
+
+Return value: None.
+
+How it works:
+1. Draws a ticket by adding one to the high 16 bits of the ticket word.
+2. Until the low 16 bits serve that ticket, sleeps on the word: every
+	ticket drawn or served changes it and wakes the sleepers, which check
+	again. The neighbours get the fork in the order they asked for it.
+*/
+void	ticket_lock(t_fork *fork)
+{
+	unsigned int	word;
+	unsigned int	mine;
+
+	word = atomic_fetch_add_explicit(&fork->ticket, 1U << 16,
+			memory_order_acquire);
+	mine = word >> 16;
+	word += 1U << 16;
+	while ((word & 0xFFFF) != mine)
+	{
+		futex_wait(&fork->ticket, word);
+		word = atomic_load_explicit(&fork->ticket, memory_order_acquire);
+	}
+}
+
+/*
+ticket_unlock(): Drops a fork taken with ticket_lock().
+
+Parameters: fork - A pointer to the fork.
+
+Return value: None.
+
+How it works:
+1. Serves the next ticket: adds one to the low 16 bits of the ticket word,
+	without carrying into the tickets drawn.
+2. If tickets were drawn beyond it, wakes the neighbour waiting.
+*/
+void	ticket_unlock(t_fork *fork)
+{
+	unsigned int	word;
+
+	word = atomic_load_explicit(&fork->ticket, memory_order_relaxed);
+	while (!atomic_compare_exchange_weak_explicit(&fork->ticket, &word,
+			(word & 0xFFFF0000U) | ((word + 1) & 0xFFFF),
+			memory_order_release, memory_order_relaxed))
+		;
+	if ((word >> 16) != ((word + 1) & 0xFFFF))
+		futex_wake(&fork->ticket, INT_MAX);
+}
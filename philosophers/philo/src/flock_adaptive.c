@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flock_adaptive.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:00:11 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:00:11 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+adaptive_spin(): Spins for a fork whose holder is about to drop it.
+
+Parameters: fork - A pointer to the fork.
+
+Return value: 1 if the fork was taken while spinning, 0 otherwise.
+
+How it works:
+1. A fork is held for a meal, whose end until predicts. If that end is
+	more than FORK_SPIN_US away, parking is cheaper: returns 0 at once.
+2. Otherwise, yields and retries until the fork is free, or until
+	FORK_SPIN_US past the predicted end, when the prediction has failed.
+*/
+static int	adaptive_spin(t_fork *fork)
+{
+	u_int64_t	until;
+	int			c;
+
+	until = atomic_load_explicit(&fork->until, memory_order_relaxed);
+	if (until > get_time() + FORK_SPIN_US)
+		return (0);
+	while (get_time() < until + FORK_SPIN_US)
+	{
+		c = FORK_FREE;
+		if (atomic_load_explicit(&fork->state, memory_order_relaxed) == c
+			&& atomic_compare_exchange_weak_explicit(&fork->state, &c,
+				FORK_TAKEN, memory_order_acquire, memory_order_relaxed))
+			return (1);
+		sched_yield();
+	}
+	return (0);
+}
+
+/*
+adaptive_lock(): Takes a fork, spinning or parking depending on how long
+				its holder is expected to keep it.
+
+Parameters: fork - A pointer to the fork.
+            hold_us - How long the caller will hold it: the time to eat.
+
+Return value: None.
+
+How it works:
+1. Takes the fork if it is free, or spins for it with adaptive_spin().
+2. Otherwise, marks it FORK_WAITED and sleeps on state until the holder
+	drops it and wakes a waiter. The fork stays FORK_WAITED once taken
+	this way, so that its drop wakes any other sleeper.
+3. Records when the caller is expected to drop the fork.
+*/
+void	adaptive_lock(t_fork *fork, u_int64_t hold_us)
+{
+	int	c;
+
+	c = FORK_FREE;
+	if (!atomic_compare_exchange_strong_explicit(&fork->state, &c, FORK_TAKEN,
+			memory_order_acquire, memory_order_relaxed)
+		&& !adaptive_spin(fork))
+	{
+		while (atomic_exchange_explicit(&fork->state, FORK_WAITED,
+				memory_order_acquire) != FORK_FREE)
+			futex_wait(&fork->state, FORK_WAITED);
+	}
+	atomic_store_explicit(&fork->until, get_time() + hold_us,
+		memory_order_relaxed);
+}
+
+/*
+adaptive_unlock(): Drops a fork taken with adaptive_lock().
+
+Parameters: fork - A pointer to the fork.
+
+Return value: None.
+
+How it works:
+1. Sets the fork free, and if a neighbour is sleeping on it, wakes it.
+*/
+void	adaptive_unlock(t_fork *fork)
+{
+	if (atomic_exchange_explicit(&fork->state, FORK_FREE,
+			memory_order_release) == FORK_WAITED)
+		futex_wake(&fork->state, 1);
+}
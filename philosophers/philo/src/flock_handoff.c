@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flock_handoff.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:06:34 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:06:34 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+handoff_lock(): Takes a fork with the hand-off lock.
+
+Parameters: fork - A pointer to the fork.
+            id - The id of the philosopher taking it.
+
+Return value: None.
+
+How it works:
+1. If the fork is free, takes it by writing id as its holder.
+2. Otherwise, writes id as its waiter and sleeps on the word until the
+	holder drops the fork, which makes the waiter its holder in the same
+	atomic write. The waiter never races for the fork once woken: it
+	owns it already, and its neighbour cannot take it back.
+*/
+void	handoff_lock(t_fork *fork, int id)
+{
+	int	word;
+
+	word = atomic_load_explicit(&fork->state, memory_order_acquire);
+	while ((word & 0xFFFF) != id)
+	{
+		if (word == 0 && atomic_compare_exchange_weak_explicit(&fork->state,
+				&word, id, memory_order_acquire, memory_order_acquire))
+			return ;
+		if (word != 0 && (word >> 16) != id
+			&& atomic_compare_exchange_weak_explicit(&fork->state, &word,
+				word | id << 16, memory_order_acquire, memory_order_acquire))
+			word |= id << 16;
+		if (word != 0 && (word >> 16) == id)
+		{
+			futex_wait(&fork->state, word);
+			word = atomic_load_explicit(&fork->state, memory_order_acquire);
+		}
+	}
+}
+
+/*
+handoff_unlock(): Drops a fork taken with handoff_lock().
+
+Parameters: fork - A pointer to the fork.
+
+Return value: None.
+
+How it works:
+1. Makes the waiter, if any, the holder of the fork, and frees it
+	otherwise, in one atomic write.
+2. If there was a waiter, wakes it: it is the only thread sleeping on the
+	fork, since a fork has two neighbours.
+*/
+void	handoff_unlock(t_fork *fork)
+{
+	int	word;
+
+	word = atomic_load_explicit(&fork->state, memory_order_relaxed);
+	while (!atomic_compare_exchange_weak_explicit(&fork->state, &word,
+			word >> 16, memory_order_release, memory_order_relaxed))
+		;
+	if (word >> 16)
+		futex_wake(&fork->state, 1);
+}
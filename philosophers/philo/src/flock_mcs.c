@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flock_mcs.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:00:11 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:00:11 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+mcs_lock(): Takes a fork with an MCS queue lock.
+
+Parameters: fork - A pointer to the fork.
+            node - The caller's node for this fork, unused until
+				mcs_unlock().
+
+Return value: None.
+
+How it works:
+1. Swaps the node in as the tail of the fork's queue. If the queue was
+	empty, the fork is taken.
+2. Otherwise, links the node behind the previous tail and sleeps on its
+	own locked flag until the previous holder clears it: each waiter
+	waits on its own cache line instead of on the fork.
+*/
+void	mcs_lock(t_fork *fork, t_mcs_node *node)
+{
+	t_mcs_node	*prev;
+
+	atomic_store_explicit(&node->next, NULL, memory_order_relaxed);
+	atomic_store_explicit(&node->locked, 1, memory_order_relaxed);
+	prev = atomic_exchange_explicit(&fork->tail, node, memory_order_acq_rel);
+	if (!prev)
+		return ;
+	atomic_store_explicit(&prev->next, node, memory_order_release);
+	while (atomic_load_explicit(&node->locked, memory_order_acquire))
+		futex_wait(&node->locked, 1);
+}
+
+/*
+mcs_unlock(): Drops a fork taken with mcs_lock().
+
+Parameters: fork - A pointer to the fork.
+            node - The node given to mcs_lock().
+
+Return value: None.
+
+How it works:
+1. If no node is linked behind the caller's, tries to empty the queue.
+	If another node was swapped in meanwhile, waits until it is linked.
+2. Hands the fork to the next node: clears its locked flag and wakes its
+	thread.
+*/
+void	mcs_unlock(t_fork *fork, t_mcs_node *node)
+{
+	t_mcs_node	*next;
+	t_mcs_node	*expected;
+
+	next = atomic_load_explicit(&node->next, memory_order_acquire);
+	if (!next)
+	{
+		expected = node;
+		if (atomic_compare_exchange_strong_explicit(&fork->tail, &expected,
+				NULL, memory_order_acq_rel, memory_order_acquire))
+			return ;
+		next = atomic_load_explicit(&node->next, memory_order_acquire);
+		while (!next)
+		{
+			sched_yield();
+			next = atomic_load_explicit(&node->next, memory_order_acquire);
+		}
+	}
+	atomic_store_explicit(&next->locked, 0, memory_order_release);
+	futex_wake(&next->locked, 1);
+}
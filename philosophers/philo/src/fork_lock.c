@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_lock.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:28:25 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 04:08:09 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+fork_lock(): Takes a fork, waiting for it if a neighbour holds it.
+
+Parameters: philo - A pointer to the philosopher taking the fork.
+            fork - A pointer to the fork.
+
+Return value: None.
+
+How it works:
+1. With one thread per philosopher, takes the fork with the --fork-lock
+	lock, the fork's mutex by default, or with --forks=hunger, waits for
+	it behind a hungrier neighbour. The MCS lock queues the philosopher's
+	node for that fork, mcs[0] for its left one and mcs[1] for its right.
+2. With --coroutines, takes the fork like a pool task does, and parks the
+	coroutine until the neighbour drops it, then tries again.
+*/
+void	fork_lock(t_philo *philo, t_fork *fork)
+{
+	if (philo->data->opts.forks == FORKS_HUNGER)
+		hunger_lock(philo, fork);
+	else if (philo->data->opts.coroutines)
+	{
+		while (!pfork_take(philo->data, philo->id - 1, fork))
+			co_park();
+	}
+	else if (philo->data->opts.fork_lock == LOCK_TICKET)
+		ticket_lock(fork);
+	else if (philo->data->opts.fork_lock == LOCK_MCS)
+		mcs_lock(fork, &philo->mcs[fork != philo->left_f]);
+	else if (philo->data->opts.fork_lock == LOCK_ADAPTIVE)
+		adaptive_lock(fork, pull_eat_time(philo->data));
+	else if (philo->data->opts.fork_lock == LOCK_HANDOFF)
+		handoff_lock(fork, philo->id);
+	else
+		pthread_mutex_lock(&fork->mu);
+}
+
+/*
+fork_unlock(): Drops a fork taken with fork_lock().
+
+Parameters: philo - A pointer to the philosopher dropping the fork.
+            fork - A pointer to the fork.
+
+Return value: None.
+
+How it works:
+1. With one thread per philosopher, drops the fork with the --fork-lock
+	lock, or with --forks=hunger, hands it to the neighbour waiting for it.
+2. With --coroutines, sets the fork free and resumes the neighbour
+	parked on it, if any.
+*/
+void	fork_unlock(t_philo *philo, t_fork *fork)
+{
+	if (philo->data->opts.forks == FORKS_HUNGER)
+		hunger_unlock(philo, fork);
+	else if (philo->data->opts.coroutines)
+		pfork_drop(philo->data, philo->id - 1, fork);
+	else if (philo->data->opts.fork_lock == LOCK_TICKET)
+		ticket_unlock(fork);
+	else if (philo->data->opts.fork_lock == LOCK_MCS)
+		mcs_unlock(fork, &philo->mcs[fork != philo->left_f]);
+	else if (philo->data->opts.fork_lock == LOCK_ADAPTIVE)
+		adaptive_unlock(fork);
+	else if (philo->data->opts.fork_lock == LOCK_HANDOFF)
+		handoff_unlock(fork);
+	else
+		pthread_mutex_unlock(&fork->mu);
+}
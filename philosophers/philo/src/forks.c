@@ -6,7 +6,7 @@
 /*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2023/12/04 20:58:04 by pmelis            #+#    #+#             */
-/*   Updated: 2023/12/12 20:05:45 by pmelis           ###   ########.fr       */
+/*   Updated: 2026/10/18 04:24:17 by pmelis           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -20,11 +20,11 @@ Parameters: philo - A pointer to the philosopher structure.
 Return value: None.
 
 How it works:
-1. Unlocks the mutex associated with the left fork of the philosopher.
+1. Drops the left fork of the philosopher with fork_unlock.
 */
 void	drop_left(t_philo *philo)
 {
-	pthread_mutex_unlock(philo->left_f);
+	fork_unlock(philo, philo->left_f);
 }
 
 /*
@@ -35,11 +35,11 @@ Parameters: philo - A pointer to the philosopher structure.
 Return value: None.
 
 How it works:
-1. Unlocks the mutex associated with the right fork of the philosopher.
+1. Drops the right fork of the philosopher with fork_unlock.
 */
 void	drop_right(t_philo *philo)
 {
-	pthread_mutex_unlock(philo->right_f);
+	fork_unlock(philo, philo->right_f);
 }
 
 /*
@@ -51,15 +51,15 @@ Return value: 1 if the philosopher is dead or dying, 0 otherwise.
 
 How it works:
 1. Checks if the philosopher is dead or dying.
-2. If not, locks the mutex associated with the left fork of the philosopher.
+2. If not, takes the left fork of the philosopher with fork_lock.
 3. Prints a message indicating the philosopher has taken a fork.
 */
 int	take_left(t_philo *philo)
 {
 	if (philo_death(philo) || pull_philo_state(philo) == DEAD)
 		return (1);
-	pthread_mutex_lock(philo->left_f);
-	print_changestate(philo->data, philo->id, "has taken a fork");
+	fork_lock(philo, philo->left_f);
+	print_changestate(philo->data, philo->id, MSG_FORK);
 	return (0);
 }
 
@@ -72,15 +72,15 @@ Return value: 1 if the philosopher is dead or dying, 0 otherwise.
 
 How it works:
 1. Checks if the philosopher is dead or dying.
-2. If not, locks the mutex associated with the right fork of the philosopher.
+2. If not, takes the right fork of the philosopher with fork_lock.
 3. Prints a message indicating the philosopher has taken a fork.
 */
 int	take_right(t_philo *philo)
 {
 	if (philo_death(philo) || pull_philo_state(philo) == DEAD)
 		return (1);
-	pthread_mutex_lock(philo->right_f);
-	print_changestate(philo->data, philo->id, "has taken a fork");
+	fork_lock(philo, philo->right_f);
+	print_changestate(philo->data, philo->id, MSG_FORK);
 	return (0);
 }
 
@@ -94,35 +94,20 @@ Return value: 1 if the philosopher is unable to take both forks, 0 otherwise.
 How it works:
 1. Checks if there is only one philosopher.
 	If so, handles this special case by calling `handle_1`.
-2. Attempts to take the right fork by calling `take_right`.
-	If unsuccessful, returns 1.
-3. Attempts to take the left fork by calling `take_left`.
-	If unsuccessful, drops the right fork by calling `drop_right` and returns 1.
-4. If both forks are successfully taken, returns 0.
+2. Takes both forks with the take function of the --forks strategy.
+3. Adds the time that took to the philosopher's wait span, for
+	forks_report() and stats_report().
 */
 int	take_both(t_philo *philo)
 {
+	u_int64_t	start;
+	int			ret;
+
 	if (pull_n_philos(philo->data) == 1)
 		return (handle_1(philo));
-	if (philo->id % 2 == 0)
-	{
-		if (take_right(philo) != 0)
-			return (1);
-		if (take_left(philo) != 0)
-		{
-			drop_right(philo);
-			return (1);
-		}
-	}
-	else
-	{
-		if (take_left(philo) != 0)
-			return (1);
-		if (take_right(philo) != 0)
-		{
-			drop_left(philo);
-			return (1);
-		}
-	}
-	return (0);
+	start = get_time();
+	ret = philo->data->arb.s->take(philo);
+	start = get_time() - start;
+	stats_span(&philo->hot->stats[STAT_WAIT], start);
+	return (ret);
 }
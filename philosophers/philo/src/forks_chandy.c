@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   forks_chandy.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:45:27 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 02:58:30 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+cm_claim(): Waits until a philosopher owns one of its forks.
+
+Parameters: philo - A pointer to the philosopher structure.
+            fork - The fork, whose mutex guards its Chandy-Misra state.
+            cm - The Chandy-Misra state of the fork.
+
+Return value: 0 if the philosopher owns the fork, 1 if the simulation is
+				over.
+
+How it works:
+1. Under the fork's mutex, waits until the philosopher owns the fork, or
+	the neighbour owning it holds it dirty and does not use it.
+2. In that case the neighbour gives the fork away: the philosopher owns it
+	now, clean, and keeps it until its meal.
+*/
+static int	cm_claim(t_philo *philo, t_fork *fork, t_arb_fork *cm)
+{
+	int	owned;
+
+	pthread_mutex_lock(&fork->mu);
+	while (cm->owner != philo->id && (!cm->dirty || cm->used)
+		&& pull_keep_iter(philo->data))
+		pthread_cond_wait(&cm->cv, &fork->mu);
+	if (cm->owner != philo->id && cm->dirty && !cm->used)
+	{
+		cm->owner = philo->id;
+		cm->dirty = 0;
+	}
+	owned = cm->owner == philo->id;
+	pthread_mutex_unlock(&fork->mu);
+	return (!owned);
+}
+
+/*
+cm_commit(): Starts using both forks if the philosopher still owns them.
+
+Parameters: philo - A pointer to the philosopher structure.
+            first - The fork with the lower address, locked first.
+            second - The other fork.
+
+Return value: 1 if the philosopher uses both forks now, 0 if a neighbour
+				took a dirty one away while it was waiting for the other.
+*/
+static int	cm_commit(t_philo *philo, t_fork *first, t_fork *second)
+{
+	t_arb_fork	*cm;
+	t_arb_fork	*cm2;
+	int			owned;
+
+	cm = &philo->data->arb.fork[philo->id - 1];
+	cm2 = &philo->data->arb.fork[(philo->id + philo->data->conf.n_philos - 2)
+		% philo->data->conf.n_philos];
+	pthread_mutex_lock(&first->mu);
+	pthread_mutex_lock(&second->mu);
+	owned = cm->owner == philo->id && cm2->owner == philo->id;
+	cm->used = owned;
+	cm2->used = owned;
+	pthread_mutex_unlock(&second->mu);
+	pthread_mutex_unlock(&first->mu);
+	return (owned);
+}
+
+/*
+cm_take(): Takes both forks with the Chandy-Misra dirty/clean rule.
+
+Parameters: philo - A pointer to the philosopher structure.
+
+Return value: 1 if the philosopher is unable to take both forks, 0 otherwise.
+
+How it works:
+1. Checks if the philosopher is dead or dying.
+2. Claims the left fork, fork id - 1, then the right fork, fork id - 2
+	around the table, and starts using both if it still owns them. A
+	dirty fork it owned already may have been taken away meanwhile; then
+	claims them again.
+3. Prints that the philosopher has taken both forks.
+*/
+int	cm_take(t_philo *philo)
+{
+	t_arb_fork	*cm;
+	int			n;
+
+	n = philo->data->conf.n_philos;
+	cm = philo->data->arb.fork;
+	while (1)
+	{
+		if (philo_death(philo) || pull_philo_state(philo) == DEAD
+			|| cm_claim(philo, philo->left_f, &cm[philo->id - 1])
+			|| cm_claim(philo, philo->right_f, &cm[(philo->id + n - 2) % n]))
+			return (1);
+		if ((philo->left_f < philo->right_f
+				&& cm_commit(philo, philo->left_f, philo->right_f))
+			|| (philo->left_f > philo->right_f
+				&& cm_commit(philo, philo->right_f, philo->left_f)))
+			break ;
+	}
+	print_changestate(philo->data, philo->id, MSG_FORK);
+	print_changestate(philo->data, philo->id, MSG_FORK);
+	return (0);
+}
+
+/*
+cm_drop(): Stops using both forks, which are dirty after the meal.
+
+Parameters: philo - A pointer to the philosopher structure.
+
+Return value: None.
+
+How it works:
+1. Under each fork's mutex, marks the fork as dirty and unused, and wakes
+	the neighbour that may be waiting to claim it.
+*/
+void	cm_drop(t_philo *philo)
+{
+	t_arb_fork	*cm;
+	int			n;
+
+	n = philo->data->conf.n_philos;
+	cm = &philo->data->arb.fork[philo->id - 1];
+	pthread_mutex_lock(&philo->left_f->mu);
+	cm->used = 0;
+	cm->dirty = 1;
+	pthread_cond_broadcast(&cm->cv);
+	pthread_mutex_unlock(&philo->left_f->mu);
+	cm = &philo->data->arb.fork[(philo->id + n - 2) % n];
+	pthread_mutex_lock(&philo->right_f->mu);
+	cm->used = 0;
+	cm->dirty = 1;
+	pthread_cond_broadcast(&cm->cv);
+	pthread_mutex_unlock(&philo->right_f->mu);
+}
@@ -0,0 +1,107 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   forks_hunger.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:53:20 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 02:53:20 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+hunger_fork(): Finds the state of one of a philosopher's forks.
+
+Parameters: philo - A pointer to the philosopher structure.
+            side - 0 for its left fork, fork id - 1, 1 for its right fork,
+				fork id - 2 around the table.
+
+Return value: A pointer to the fork's state. The philosopher waits for it
+				in want[side].
+*/
+static t_arb_fork	*hunger_fork(t_philo *philo, int side)
+{
+	int	n;
+
+	n = philo->data->conf.n_philos;
+	if (side)
+		return (&philo->data->arb.fork[(philo->id + n - 2) % n]);
+	return (&philo->data->arb.fork[philo->id - 1]);
+}
+
+/*
+hunger_yields(): Tells whether a waiter has to let its neighbour go first.
+
+Parameters: f - The state of the fork they both wait for.
+            side - The side of the waiter.
+
+Return value: 1 if the neighbour on the other side waits too and dies
+				first, or at the same time and the waiter is on side 1.
+*/
+static int	hunger_yields(t_arb_fork *f, int side)
+{
+	return (f->want[!side] && (f->want[!side] < f->want[side]
+			|| (f->want[!side] == f->want[side] && side == 1)));
+}
+
+/*
+hunger_lock(): Takes a fork, giving way to a hungrier neighbour.
+
+Parameters: philo - A pointer to the philosopher taking the fork.
+            fork - A pointer to the fork, whose mutex guards its state.
+
+Return value: None.
+
+How it works:
+1. Under the fork's mutex, records the philosopher's death deadline, its
+	last meal plus the time to die, as its request for the fork.
+2. Waits until the fork is free and the neighbour on the other side does
+	not wait for it too with an earlier deadline. The neighbour takes it
+	then, and wakes the philosopher when it drops it.
+3. Withdraws the request and marks the fork as used.
+Like a mutex, this takes the fork even once the simulation is over: its
+holder always drops it, so that nobody waits forever.
+*/
+void	hunger_lock(t_philo *philo, t_fork *fork)
+{
+	t_arb_fork	*f;
+	int			side;
+
+	side = (fork == philo->right_f && fork != philo->left_f);
+	f = hunger_fork(philo, side);
+	pthread_mutex_lock(&fork->mu);
+	f->want[side] = (atomic_load_explicit(&philo->hot->meal_word,
+				memory_order_acquire) & MEAL_MASK)
+		+ pull_death_time(philo->data);
+	while (f->used || hunger_yields(f, side))
+		pthread_cond_wait(&f->cv, &fork->mu);
+	f->want[side] = 0;
+	f->used = 1;
+	pthread_mutex_unlock(&fork->mu);
+}
+
+/*
+hunger_unlock(): Drops a fork taken with hunger_lock().
+
+Parameters: philo - A pointer to the philosopher dropping the fork.
+            fork - A pointer to the fork.
+
+Return value: None.
+
+How it works:
+1. Under the fork's mutex, marks the fork as free and wakes the neighbour
+	that may be waiting for it.
+*/
+void	hunger_unlock(t_philo *philo, t_fork *fork)
+{
+	t_arb_fork	*f;
+
+	f = hunger_fork(philo, fork == philo->right_f && fork != philo->left_f);
+	pthread_mutex_lock(&fork->mu);
+	f->used = 0;
+	pthread_cond_broadcast(&f->cv);
+	pthread_mutex_unlock(&fork->mu);
+}
@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   forks_order.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:44:45 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 02:44:45 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+order_take(): Takes both forks in the order of the philosopher's parity.
+
+Parameters: philo - A pointer to the philosopher structure.
+
+Return value: 1 if the philosopher is unable to take both forks, 0 otherwise.
+
+How it works:
+1. Even philosophers take the right fork first, odd ones the left fork,
+	so that two neighbours never wait for each other in a circle.
+2. If the second fork cannot be taken, drops the first one and returns 1.
+*/
+int	order_take(t_philo *philo)
+{
+	if (philo->id % 2 == 0)
+	{
+		if (take_right(philo) != 0)
+			return (1);
+		if (take_left(philo) != 0)
+		{
+			drop_right(philo);
+			return (1);
+		}
+	}
+	else
+	{
+		if (take_left(philo) != 0)
+			return (1);
+		if (take_right(philo) != 0)
+		{
+			drop_left(philo);
+			return (1);
+		}
+	}
+	return (0);
+}
+
+/*
+order_drop(): Drops both forks taken by order_take().
+
+Parameters: philo - A pointer to the philosopher structure.
+
+Return value: None.
+*/
+void	order_drop(t_philo *philo)
+{
+	drop_left(philo);
+	drop_right(philo);
+}
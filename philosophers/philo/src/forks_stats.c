@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   forks_stats.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:46:02 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 04:24:17 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+jain(): Computes Jain's fairness index of a set of shares.
+
+Parameters: sum - The sum of the shares.
+            sum_sq - The sum of their squares.
+            n - The number of shares.
+
+Return value: (sum)^2 / (n * sum_sq), from 1 / n when a single share gets
+				everything to 1 when all shares are equal. 1 when all are 0.
+*/
+static double	jain(double sum, double sum_sq, int n)
+{
+	if (sum_sq == 0)
+		return (1);
+	return (sum * sum / (n * sum_sq));
+}
+
+/*
+forks_sum(): Sums the meals and waiting times of the philosophers.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            s - Where to store the sums of the meals, of their squares, of
+				the waiting times and of their squares, in that order.
+
+Return value: The longest wait of all, in microseconds.
+*/
+static u_int64_t	forks_sum(t_data *data, double *s)
+{
+	double		x;
+	u_int64_t	max;
+	int			i;
+
+	memset(s, 0, sizeof(double) * 4);
+	max = 0;
+	i = -1;
+	while (++i < data->conf.n_philos)
+	{
+		x = atomic_load(&data->philo[i].hot->n_meals);
+		s[0] += x;
+		s[1] += x * x;
+		x = data->philo[i].hot->stats[STAT_WAIT].sum;
+		s[2] += x;
+		s[3] += x * x;
+		if (data->philo[i].hot->stats[STAT_WAIT].max > max)
+			max = data->philo[i].hot->stats[STAT_WAIT].max;
+	}
+	return (max);
+}
+
+/*
+forks_report(): Prints how well the --forks strategy fed the table, on
+				stderr.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data, after the philosophers have joined.
+
+Return value: None.
+
+How it works:
+1. Sums the meals and the waiting times of the philosophers, and of their
+	squares, with forks_sum().
+2. Prints the strategy, the meals per second since the start, the
+	average wait for forks per meal and the longest one, and Jain's
+	fairness index of the meals and of the waiting times.
+*/
+void	forks_report(t_data *data)
+{
+	double		s[4];
+	double		avg;
+	double		secs;
+	u_int64_t	max;
+	int			n;
+
+	n = data->conf.n_philos;
+	max = forks_sum(data, s);
+	avg = 0;
+	if (s[0] > 0)
+		avg = s[2] / s[0];
+	secs = (get_time() - data->conf.start_time) / 1e6;
+	fprintf(stderr, "forks: %s, %.1f meals/s, wait per meal avg %.3f ms"
+		" max %.3f ms, Jain index %.4f over meals, %.4f over waits\n",
+		data->arb.s->name, s[0] / secs, avg / 1000, max / 1000.0,
+		jain(s[0], s[1], n), jain(s[2], s[3], n));
+}
@@ -0,0 +1,167 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   forks_strategy.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:45:45 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 04:25:24 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+static const t_strategy	g_strategies[] = {
+{"order", &order_take, &order_drop},
+{"waiter", &waiter_take, &waiter_drop},
+{"chandy", &cm_take, &cm_drop},
+{"ticket", &ticket_take, &ticket_drop},
+{"hunger", &order_take, &order_drop}
+};
+
+/*
+parse_forks(): Parses the value of --forks.
+
+Parameters: val - The value of the option.
+            opts - A pointer to the options structure.
+
+Return value: 0 if the value names a strategy, 1 otherwise.
+*/
+int	parse_forks(char *val, t_opts *opts)
+{
+	int	i;
+
+	i = FORKS_ORDER;
+	while (i <= FORKS_HUNGER && strcmp(val, g_strategies[i].name))
+		i++;
+	opts->forks = (t_forks_algo)i;
+	return (i > FORKS_HUNGER);
+}
+
+/*
+arb_fork_init(): Sets up the state of the forks kept by the Chandy-Misra
+					and hunger strategies.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: 0 on success, 1 if the allocation fails.
+
+How it works:
+1. Every fork starts unused and wanted by nobody.
+2. For Chandy-Misra, it starts dirty, owned by the lower numbered of its
+	two philosophers: fork i is between philosophers i + 1 and i + 2, the
+	last one between philosophers n and 1.
+*/
+static int	arb_fork_init(t_data *data)
+{
+	int	i;
+	int	n;
+
+	n = data->conf.n_philos;
+	data->arb.fork = calloc(n, sizeof(t_arb_fork));
+	if (!data->arb.fork)
+		return (1);
+	i = -1;
+	while (++i < n)
+	{
+		pthread_cond_init(&data->arb.fork[i].cv, NULL);
+		data->arb.fork[i].owner = 1;
+		if (i + 1 < n)
+			data->arb.fork[i].owner = i + 1;
+		data->arb.fork[i].dirty = 1;
+	}
+	return (0);
+}
+
+/*
+strategy_init(): Sets up the --forks strategy.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: 0 on success, 1 if the strategy cannot be used.
+
+How it works:
+1. Picks the strategy's take and drop functions. opts_check() already
+	kept the other strategies and locks out of the worker pool and the
+	coroutines, which cannot block.
+2. Initializes the arbiter: the waiter's busy forks, the ticket counters
+	with n - 1 tickets served at a time, and the state of the forks for
+	the Chandy-Misra and hunger strategies.
+*/
+int	strategy_init(t_data *data)
+{
+	data->arb.s = &g_strategies[data->opts.forks];
+	pthread_mutex_init(&data->arb.mu, NULL);
+	pthread_cond_init(&data->arb.cv, NULL);
+	data->arb.tokens = data->conf.n_philos - 1;
+	if (data->opts.forks == FORKS_WAITER)
+		data->arb.busy = calloc(data->conf.n_philos, sizeof(int));
+	if ((data->opts.forks == FORKS_WAITER && !data->arb.busy)
+		|| ((data->opts.forks == FORKS_CHANDY
+				|| data->opts.forks == FORKS_HUNGER) && arb_fork_init(data)))
+	{
+		write(2, "philo: cannot set up the forks\n", 31);
+		return (1);
+	}
+	return (0);
+}
+
+/*
+strategy_wake(): Wakes the philosophers waiting in a --forks strategy.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: None.
+
+How it works:
+1. Broadcasts the arbiter's condition variable, under its mutex, so that
+	the philosophers waiting for the waiter or a ticket see the simulation
+	is over.
+2. Does the same for each fork the Chandy-Misra and hunger strategies may
+	wait for.
+*/
+void	strategy_wake(t_data *data)
+{
+	int	i;
+
+	if (!data->arb.s)
+		return ;
+	pthread_mutex_lock(&data->arb.mu);
+	pthread_cond_broadcast(&data->arb.cv);
+	pthread_mutex_unlock(&data->arb.mu);
+	i = -1;
+	while (data->arb.fork && ++i < data->conf.n_philos)
+	{
+		pthread_mutex_lock(&fork_at(data, i)->mu);
+		pthread_cond_broadcast(&data->arb.fork[i].cv);
+		pthread_mutex_unlock(&fork_at(data, i)->mu);
+	}
+}
+
+/*
+strategy_free(): Frees the state of the --forks strategy.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: None.
+*/
+void	strategy_free(t_data *data)
+{
+	int	i;
+
+	if (!data->arb.s)
+		return ;
+	pthread_mutex_destroy(&data->arb.mu);
+	pthread_cond_destroy(&data->arb.cv);
+	i = -1;
+	while (data->arb.fork && ++i < data->conf.n_philos)
+		pthread_cond_destroy(&data->arb.fork[i].cv);
+	free(data->arb.fork);
+	free(data->arb.busy);
+	memset(&data->arb, 0, sizeof(t_arbiter));
+}
@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   forks_ticket.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:45:27 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 02:45:27 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+ticket_give_back(): Gives a philosopher's ticket back.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: None.
+
+How it works:
+1. Under the arbiter's mutex, counts one more ticket given back, which
+	serves the next ticket in line.
+2. Wakes the philosophers waiting for their ticket to be served.
+*/
+static void	ticket_give_back(t_data *data)
+{
+	pthread_mutex_lock(&data->arb.mu);
+	data->arb.done++;
+	pthread_cond_broadcast(&data->arb.cv);
+	pthread_mutex_unlock(&data->arb.mu);
+}
+
+/*
+ticket_take(): Draws a ticket, waits until it is served, then takes both
+				forks.
+
+Parameters: philo - A pointer to the philosopher structure.
+
+Return value: 1 if the philosopher is unable to take both forks, 0 otherwise.
+
+How it works:
+1. Under the arbiter's mutex, draws the next ticket and waits until fewer
+	than n - 1 tickets drawn before it are still out, or the simulation
+	is over, in which case returns 1. Tickets are served in the order they
+	were drawn.
+2. With at most n - 1 philosophers reaching for their forks, one of them
+	always gets both: takes the left fork, then the right one. If the
+	philosopher dies meanwhile, drops what it holds, gives the ticket back
+	and returns 1.
+*/
+int	ticket_take(t_philo *philo)
+{
+	t_arbiter	*arb;
+	u_int64_t	ticket;
+	int			served;
+
+	arb = &philo->data->arb;
+	pthread_mutex_lock(&arb->mu);
+	ticket = arb->next++;
+	while (ticket >= arb->done + arb->tokens && pull_keep_iter(philo->data))
+		pthread_cond_wait(&arb->cv, &arb->mu);
+	served = ticket < arb->done + arb->tokens && pull_keep_iter(philo->data);
+	pthread_mutex_unlock(&arb->mu);
+	if (!served)
+		return (1);
+	if (take_left(philo))
+	{
+		ticket_give_back(philo->data);
+		return (1);
+	}
+	if (take_right(philo))
+	{
+		drop_left(philo);
+		ticket_give_back(philo->data);
+		return (1);
+	}
+	return (0);
+}
+
+/*
+ticket_drop(): Drops both forks and gives the ticket back.
+
+Parameters: philo - A pointer to the philosopher structure.
+
+Return value: None.
+*/
+void	ticket_drop(t_philo *philo)
+{
+	drop_left(philo);
+	drop_right(philo);
+	ticket_give_back(philo->data);
+}
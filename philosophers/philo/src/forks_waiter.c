@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   forks_waiter.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:44:53 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 02:44:53 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+waiter_give_back(): Tells the waiter that a philosopher's forks are free.
+
+Parameters: philo - A pointer to the philosopher structure.
+
+Return value: None.
+
+How it works:
+1. Under the waiter's mutex, marks the philosopher's left and right forks
+	as free.
+2. Wakes the philosophers waiting for the waiter, so that the neighbours
+	can check whether both their forks are free now.
+*/
+static void	waiter_give_back(t_philo *philo)
+{
+	t_arbiter	*arb;
+	int			n;
+
+	arb = &philo->data->arb;
+	n = philo->data->conf.n_philos;
+	pthread_mutex_lock(&arb->mu);
+	arb->busy[philo->id - 1] = 0;
+	arb->busy[(philo->id + n - 2) % n] = 0;
+	pthread_cond_broadcast(&arb->cv);
+	pthread_mutex_unlock(&arb->mu);
+}
+
+/*
+waiter_ask(): Waits until the waiter lends both forks of a philosopher.
+
+Parameters: philo - A pointer to the philosopher structure.
+            left - The index of the philosopher's left fork.
+            right - The index of the philosopher's right fork.
+
+Return value: 1 if the forks are lent, 0 if the simulation is over.
+
+How it works:
+1. Under the waiter's mutex, waits until both forks are free or the
+	simulation is over.
+2. If it is not over, marks both forks as lent to the philosopher, so
+	that no neighbour can hold one of them while waiting for the other.
+*/
+static int	waiter_ask(t_philo *philo, int left, int right)
+{
+	t_arbiter	*arb;
+	int			lent;
+
+	arb = &philo->data->arb;
+	pthread_mutex_lock(&arb->mu);
+	while ((arb->busy[left] || arb->busy[right])
+		&& pull_keep_iter(philo->data))
+		pthread_cond_wait(&arb->cv, &arb->mu);
+	lent = pull_keep_iter(philo->data)
+		&& !arb->busy[left] && !arb->busy[right];
+	arb->busy[left] |= lent;
+	arb->busy[right] |= lent;
+	pthread_mutex_unlock(&arb->mu);
+	return (lent);
+}
+
+/*
+waiter_take(): Asks the waiter for both forks, then takes them.
+
+Parameters: philo - A pointer to the philosopher structure.
+
+Return value: 1 if the philosopher is unable to take both forks, 0 otherwise.
+
+How it works:
+1. Asks the waiter for the left fork, fork id - 1, and the right fork,
+	fork id - 2 around the table. If the simulation is over, returns 1.
+2. Takes the forks, which only their previous user may still be
+	dropping. If the philosopher dies meanwhile, drops what it holds,
+	gives the forks back and returns 1.
+*/
+int	waiter_take(t_philo *philo)
+{
+	int	n;
+
+	n = philo->data->conf.n_philos;
+	if (!waiter_ask(philo, philo->id - 1, (philo->id + n - 2) % n))
+		return (1);
+	if (take_left(philo))
+	{
+		waiter_give_back(philo);
+		return (1);
+	}
+	if (take_right(philo))
+	{
+		drop_left(philo);
+		waiter_give_back(philo);
+		return (1);
+	}
+	return (0);
+}
+
+/*
+waiter_drop(): Drops both forks and gives them back to the waiter.
+
+Parameters: philo - A pointer to the philosopher structure.
+
+Return value: None.
+*/
+void	waiter_drop(t_philo *philo)
+{
+	drop_left(philo);
+	drop_right(philo);
+	waiter_give_back(philo);
+}
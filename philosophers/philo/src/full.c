@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   full.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:00:27 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:17:22 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+full_init(): Initializes the satisfied counter and its wake-up.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: None.
+
+How it works:
+1. Sets the number of satisfied philosophers to 0.
+2. Initializes the mutex and condition variable the completion monitor
+	sleeps on, process-shared with --processes.
+*/
+void	full_init(t_data *data)
+{
+	atomic_init(&data->full.n, 0);
+	sync_init(data, &data->full.mu, &data->full.cv);
+}
+
+/*
+full_signal(): Counts a philosopher that just had its last required meal.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: None.
+
+How it works:
+1. Atomically increments the number of satisfied philosophers.
+2. If it was the last one, wakes the completion monitor. The broadcast is
+	made under the mutex so the wake-up cannot be lost.
+*/
+void	full_signal(t_data *data)
+{
+	if (atomic_fetch_add_explicit(&data->full.n, 1, memory_order_acq_rel) + 1
+		!= data->conf.n_philos)
+		return ;
+	pthread_mutex_lock(&data->full.mu);
+	pthread_cond_broadcast(&data->full.cv);
+	pthread_mutex_unlock(&data->full.mu);
+}
+
+/*
+full_wait(): Blocks until every philosopher is satisfied or the simulation
+				is stopping.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: 1 if every philosopher is satisfied, 0 otherwise.
+
+How it works:
+1. Sleeps on the condition variable while some philosopher still has
+	meals to eat and the simulation goes on. full_signal() and
+	push_keep_iter() broadcast on it, so there is no polling.
+*/
+int	full_wait(t_data *data)
+{
+	int	n_philos;
+	int	n_full;
+
+	n_philos = pull_n_philos(data);
+	pthread_mutex_lock(&data->full.mu);
+	n_full = atomic_load_explicit(&data->full.n, memory_order_acquire);
+	while (n_full < n_philos && pull_keep_iter(data))
+	{
+		pthread_cond_wait(&data->full.cv, &data->full.mu);
+		n_full = atomic_load_explicit(&data->full.n, memory_order_acquire);
+	}
+	pthread_mutex_unlock(&data->full.mu);
+	return (n_full >= n_philos);
+}
+
+/*
+full_destroy(): Destroys the satisfied counter's mutex and condition
+				variable.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: None.
+*/
+void	full_destroy(t_data *data)
+{
+	pthread_mutex_destroy(&data->full.mu);
+	pthread_cond_destroy(&data->full.cv);
+}
@@ -6,7 +6,7 @@
 /*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2023/12/04 21:29:24 by pmelis            #+#    #+#             */
-/*   Updated: 2023/12/12 20:09:23 by pmelis           ###   ########.fr       */
+/*   Updated: 2026/10/18 02:16:35 by pmelis           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -49,14 +49,13 @@ How it works:
 */
 int	n_meal_trigger(t_data *data)
 {
-	if (data->n_meals > 0)
+	if (data->conf.n_meals > 0)
 		return (1);
 	return (0);
 }
 
 /*
-print_changestate(): Prints a message about a philosopher's state change with
-						mutual exclusion.
+print_changestate(): Logs a philosopher's state change.
 
 Parameters: data - A pointer to the data structure that holds
 					the simulation data.
@@ -66,19 +65,40 @@ Parameters: data - A pointer to the data structure that holds
 Return value: None.
 
 How it works:
-1. Calculates the time since the start of the simulation.
-2. Locks the print mutex.
-3. If the simulation is still running, prints the time, philosopher id,
-	and message.
-4. Unlocks the print mutex.
+1. If the simulation is still running, pushes a timestamped event into the
+	calling thread's log ring with log_push. It never locks and never
+	waits for stdout: the writer thread formats and prints the events in
+	timestamp order.
 */
-void	print_changestate(t_data *data, int id, char *msg)
+void	print_changestate(t_data *data, int id, t_msg msg)
 {
-	u_int64_t	time;
-
-	pthread_mutex_lock(&data->print_mu);
-	time = get_time() - pull_start_time(data);
 	if (pull_keep_iter(data))
-		printf("%llu %d %s\n", time, id, msg);
-	pthread_mutex_unlock(&data->print_mu);
+		log_push(id, msg);
+}
+
+/*
+think_time(): Returns how long a philosopher thinks before reaching for
+				the forks.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: The thinking time, in microseconds.
+
+How it works:
+1. With an odd number of philosophers, returns 2 * time to eat - time to
+	sleep, so a philosopher that just woke up does not grab a fork before
+	the neighbour that has been waiting for it since the last round.
+2. Otherwise, or if that is not positive, returns 0.
+*/
+u_int64_t	think_time(t_data *data)
+{
+	u_int64_t	us_toeat;
+	u_int64_t	us_tosleep;
+
+	us_toeat = pull_eat_time(data);
+	us_tosleep = pull_sleep_time(data);
+	if (pull_n_philos(data) % 2 == 1 && 2 * us_toeat > us_tosleep)
+		return (2 * us_toeat - us_tosleep);
+	return (0);
 }
@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hist.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:26:02 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:30:22 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+hist_index(): Finds the bucket of a value.
+
+Parameters: value - The value.
+
+Return value: The index of its bucket.
+
+How it works:
+1. Values below HIST_SUB are their own bucket.
+2. Otherwise, finds the highest set bit. The HIST_SUB_BITS bits below it
+	pick one of the HIST_SUB buckets of that power of two; the bits
+	further down are dropped.
+*/
+static int	hist_index(u_int64_t value)
+{
+	int	msb;
+
+	if (value < HIST_SUB)
+		return ((int)value);
+	msb = HIST_SUB_BITS;
+	while (msb < 63 && value >> (msb + 1))
+		msb++;
+	return ((msb - HIST_SUB_BITS + 1) * HIST_SUB
+		+ (int)((value >> (msb - HIST_SUB_BITS)) - HIST_SUB));
+}
+
+/*
+hist_value(): Returns the highest value of a bucket.
+
+Parameters: i - The index of the bucket.
+
+Return value: The largest value hist_index() puts in bucket i, so a
+				percentile read from the buckets is never understated.
+*/
+static u_int64_t	hist_value(int i)
+{
+	int	shift;
+
+	if (i < HIST_SUB)
+		return ((u_int64_t)i);
+	shift = i / HIST_SUB - 1;
+	return ((((u_int64_t)(HIST_SUB + i % HIST_SUB) + 1) << shift) - 1);
+}
+
+/*
+hist_record(): Adds a value to a histogram.
+
+Parameters: hist - A pointer to the histogram.
+            value - The value.
+
+Return value: None.
+
+How it works:
+1. Counts the value in its bucket and in the total, atomically, as --sweep
+	runs record into the same histogram from several threads.
+2. Raises the maximum with a CAS loop if this value is larger.
+*/
+void	hist_record(t_hist *hist, u_int64_t value)
+{
+	u_int64_t	max;
+
+	atomic_fetch_add_explicit(&hist->count[hist_index(value)], 1,
+		memory_order_relaxed);
+	atomic_fetch_add_explicit(&hist->n, 1, memory_order_relaxed);
+	max = atomic_load_explicit(&hist->max, memory_order_relaxed);
+	while (value > max)
+	{
+		if (atomic_compare_exchange_weak_explicit(&hist->max, &max,
+				value, memory_order_relaxed, memory_order_relaxed))
+			break ;
+	}
+}
+
+/*
+hist_pct(): Reads a percentile from a histogram.
+
+Parameters: hist - A pointer to the histogram.
+            pct - The percentile, from 0 to 100.
+
+Return value: The value below which pct percent of the values fall, up to
+				the width of its bucket, or 0 if the histogram is empty.
+
+How it works:
+1. Finds the rank of the percentile, by the nearest-rank method.
+2. Adds the buckets up until they reach it, and returns the highest value
+	of that bucket, no more than the exact maximum.
+*/
+u_int64_t	hist_pct(t_hist *hist, double pct)
+{
+	u_int64_t	n;
+	u_int64_t	rank;
+	u_int64_t	seen;
+	int			i;
+
+	n = atomic_load(&hist->n);
+	if (n == 0)
+		return (0);
+	rank = (u_int64_t)(pct / 100.0 * n);
+	if (rank < pct / 100.0 * n || rank == 0)
+		rank++;
+	i = 0;
+	seen = atomic_load(&hist->count[0]);
+	while (seen < rank && i < HIST_BUCKETS - 1)
+		seen += atomic_load(&hist->count[++i]);
+	if (hist_value(i) > atomic_load(&hist->max))
+		return (atomic_load(&hist->max));
+	return (hist_value(i));
+}
@@ -6,7 +6,7 @@
 /*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2023/12/04 20:19:15 by pmelis            #+#    #+#             */
-/*   Updated: 2023/12/09 20:42:28 by pmelis           ###   ########.fr       */
+/*   Updated: 2026/10/18 02:19:32 by pmelis           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -22,17 +22,20 @@ Return value: None.
 
 How it works:	1. Prints the correct usage of the program.
 				2. Prints the valid range for each argument.
-				3. Prints the conditions under which the simulation stops.
+				3. Prints the available options using print_opts.
+				4. Prints the conditions under which the simulation stops.
 */
 void	print_error(void)
 {
-	printf("\n./philo ");
+	printf("\n./philo [options] ");
 	printf("<n_philos> <ms_todie> <ms_toeat> <ms_tosleep> (n_meals)\n\n");
-	printf("n_philos: (1-200)\n");
+	printf("n_philos: (1-200, up to %d with --workers, --pool or "
+		"--virtual-time)\n", POOL_MAX_PHILOS);
 	printf("ms_todie: (60-2147483647)\n");
 	printf("ms_toeat: (60-2147483647)\n");
 	printf("ms_tosleep: (60-2147483647)\n");
 	printf("n_meals(optional): (1-2147483647)\n\n");
+	print_opts();
 	printf("The simulation stops when someone dies or everyone is full.\n\n");
 }
 
@@ -112,25 +115,27 @@ wrong_input():	Checks if the command-line arguments are valid.
 
 Parameters:		ac - The count of command-line arguments.
 				av - An array of the command-line arguments.
+				max_philos - The largest accepted number of philosophers.
 
 Return value:	1 if any argument is invalid, 0 otherwise.
 
 How it works:	1. If there are 6 arguments and the last one is less than
 					or equal to 0, returns 1.
-				2. If the first argument is less than 1 or greater than 200,
+				2. If the first argument is less than 1 or greater than
+					max_philos,
 					returns 1.
 				3. Iterates over the next 3 arguments, if any is less than 60,
 					returns 1.
 				4. If no invalid arguments are found, returns 0.
 */
-int	wrong_input(int ac, char **av)
+int	wrong_input(int ac, char **av, int max_philos)
 {
 	int	i;
 
 	i = 1;
 	if (ac == 6 && ft_atoi(av[5]) <= 0)
 		return (1);
-	if (ft_atoi(av[i]) < 1 || ft_atoi(av[i]) > 200)
+	if (ft_atoi(av[i]) < 1 || ft_atoi(av[i]) > max_philos)
 		return (1);
 	while (++i < 5)
 	{
@@ -145,6 +150,7 @@ input_check():	Validates the command-line arguments.
 
 Parameters:		ac - The count of command-line arguments.
 				av - An array of the command-line arguments.
+				max_philos - The largest accepted number of philosophers.
 
 Return value:	1 if any argument is invalid, 0 otherwise.
 
@@ -153,13 +159,13 @@ How it works:	1. If the number of arguments is not 5 or 6, returns 1.
 				3. Checks if any argument is invalid using wrong_input function.
 				4. If no invalid arguments are found, returns 0.
 */
-int	input_check(int ac, char **av)
+int	input_check(int ac, char **av, int max_philos)
 {
 	if (!(ac >= 5 && ac <= 6))
 		return (1);
 	if (is_digit(ac, av))
 		return (1);
-	if (wrong_input(ac, av))
+	if (wrong_input(ac, av, max_philos))
 		return (1);
 	return (0);
 }
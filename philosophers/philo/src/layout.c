@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   layout.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:45:09 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:17:22 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+layout_stride(): Returns the distance between two elements of a hot array.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            size - The size of one element.
+
+Return value: The size rounded up to a whole number of cache lines in the
+				padded layout, the size itself in the packed layout.
+*/
+size_t	layout_stride(t_data *data, size_t size)
+{
+	if (data->opts.layout == LAYOUT_PACKED)
+		return (size);
+	return ((size + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE);
+}
+
+/*
+layout_alloc(): Allocates one element per philosopher with a given stride.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            stride - The distance between two elements.
+
+Return value: A pointer to the array, or NULL if the allocation fails.
+
+How it works:
+1. In the padded layout, allocates the array on a cache line boundary so
+	that each element starts its own line.
+2. In the packed layout, uses a plain malloc. Both go through data_alloc,
+	which takes the array from the shared mapping with --processes.
+*/
+void	*layout_alloc(t_data *data, size_t stride)
+{
+	return (data_alloc(data, stride * data->conf.n_philos,
+			data->opts.layout != LAYOUT_PACKED));
+}
+
+/*
+fork_at(): Returns the i-th fork.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            i - The index of the fork.
+
+Return value: A pointer to the fork.
+*/
+t_fork	*fork_at(t_data *data, int i)
+{
+	return ((t_fork *)((char *)data->forks + data->fork_stride * i));
+}
+
+/*
+hot_at(): Returns the hot data of the i-th philosopher.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            i - The index of the philosopher.
+
+Return value: A pointer to the philosopher's hot data.
+*/
+t_philo_hot	*hot_at(t_data *data, int i)
+{
+	return ((t_philo_hot *)((char *)data->hot + data->hot_stride * i));
+}
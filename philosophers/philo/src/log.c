@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   log.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:03:14 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:41:54 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+static _Thread_local t_ring	*g_ring;
+
+/*
+log_init(): Initializes the log rings, allocated by data_malloc().
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: None.
+
+How it works:
+1. Empties every ring, gives it its slice of the events array and marks
+	it idle.
+2. Resets the writer's batch. The trace and the --metrics page are closed
+	until philo() opens them.
+*/
+void	log_init(t_data *data)
+{
+	int	i;
+
+	i = -1;
+	while (++i < data->log.n_rings)
+	{
+		atomic_init(&data->log.rings[i].head, 0);
+		atomic_init(&data->log.rings[i].tail, 0);
+		atomic_init(&data->log.rings[i].busy, LOG_IDLE);
+		data->log.rings[i].ev = &data->log.events[i * data->log.ring_size];
+		data->log.rings[i].size = data->log.ring_size;
+	}
+	atomic_init(&data->log.stop, 0);
+	data->log.trace.fd = -1;
+	memset(&data->log.metrics, 0, sizeof(t_metrics));
+	data->log.died = 0;
+	data->log.buf_len = 0;
+}
+
+/*
+log_attach(): Binds the calling thread to a log ring.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            ring - The index of the ring: the philosopher's index, or the
+				number of philosophers for the death monitor.
+
+Return value: None.
+
+How it works:
+1. Stores the ring in a thread-local pointer used by log_push(), so each
+	ring only ever has one producer.
+*/
+void	log_attach(t_data *data, int ring)
+{
+	g_ring = &data->log.rings[ring];
+}
+
+/*
+log_push(): Pushes a timestamped event into the calling thread's ring.
+
+Parameters: id - The id of the philosopher.
+            msg - The message.
+
+Return value: None.
+
+How it works:
+1. If the ring is full, which only happens when the writer is starved,
+	yields until the writer makes room. It never waits for stdout.
+2. Marks the ring busy before reading the clock, then publishes the
+	timestamp in busy, so the writer never merges past this event.
+3. Writes the event, publishes it by moving head, and marks the ring idle.
+*/
+void	log_push(int id, t_msg msg)
+{
+	t_ring		*ring;
+	u_int64_t	head;
+	u_int64_t	ts;
+
+	ring = g_ring;
+	if (!ring)
+		return ;
+	head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+	while (head - atomic_load_explicit(&ring->tail, memory_order_acquire)
+		>= ring->size)
+		sched_yield();
+	atomic_store(&ring->busy, 0);
+	ts = get_time();
+	atomic_store(&ring->busy, ts);
+	ring->ev[head % ring->size].ts = ts;
+	ring->ev[head % ring->size].id = id;
+	ring->ev[head % ring->size].msg = msg;
+	atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+	atomic_store_explicit(&ring->busy, LOG_IDLE, memory_order_release);
+}
+
+/*
+log_start(): Starts the writer thread.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: 0 if the thread is created, 1 otherwise.
+*/
+int	log_start(t_data *data)
+{
+	return (pthread_create(&data->log.writer, NULL, &log_writer, data) != 0);
+}
+
+/*
+log_stop(): Stops the writer thread once every producer has finished.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: None.
+
+How it works:
+1. Sets the stop flag. The writer then drains every ring without
+	a watermark, flushes, and exits.
+2. Joins the writer thread, then finishes the trace and the --metrics
+	page, if any.
+*/
+void	log_stop(t_data *data)
+{
+	atomic_store_explicit(&data->log.stop, 1, memory_order_release);
+	pthread_join(data->log.writer, NULL);
+	if (data->log.trace.fd >= 0)
+		trace_close(&data->log.trace, pull_n_philos(data));
+	metrics_close(data);
+}
@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   log_format.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:05:18 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 02:05:18 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+static const char	g_digits[] = "00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+static const char	*g_tails[] = {
+	" has taken a fork\n",
+	" is eating\n",
+	" is sleeping\n",
+	" is thinking\n",
+	" died\n"
+};
+
+static const size_t	g_tail_lens[] = {18, 11, 13, 13, 6};
+
+/*
+fmt_uint(): Writes an unsigned number in decimal.
+
+Parameters: dst - Where to write the digits. No terminating NUL is added.
+            n - The number.
+
+Return value: The number of digits written.
+
+How it works:
+1. Fills a scratch buffer from the end, two digits per division, taking
+	each pair from a 00-99 lookup table.
+2. Writes the last one or two digits, then copies the digits to dst.
+*/
+static size_t	fmt_uint(char *dst, u_int64_t n)
+{
+	char	tmp[20];
+	int		i;
+
+	i = 20;
+	while (n >= 100)
+	{
+		i -= 2;
+		memcpy(tmp + i, g_digits + n % 100 * 2, 2);
+		n /= 100;
+	}
+	if (n >= 10)
+	{
+		i -= 2;
+		memcpy(tmp + i, g_digits + n * 2, 2);
+	}
+	else
+		tmp[--i] = '0' + n;
+	memcpy(dst, tmp + i, 20 - i);
+	return (20 - i);
+}
+
+/*
+log_format(): Formats one log line.
+
+Parameters: dst - Where to write the line, at least LOG_LINE_MAX bytes.
+            ms - The time since the start of the simulation, in
+				milliseconds.
+            id - The id of the philosopher.
+            msg - The message.
+
+Return value: The length of the line, newline included.
+
+How it works:
+1. Writes "ms id" with fmt_uint.
+2. Appends the pre-built tail of the message, " is eating\n" and so on,
+	whose length is known in advance.
+*/
+size_t	log_format(char *dst, u_int64_t ms, int id, t_msg msg)
+{
+	size_t	len;
+
+	len = fmt_uint(dst, ms);
+	dst[len++] = ' ';
+	len += fmt_uint(dst + len, id);
+	memcpy(dst + len, g_tails[msg], g_tail_lens[msg]);
+	return (len + g_tail_lens[msg]);
+}
@@ -0,0 +1,201 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   log_writer.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:03:29 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 04:22:21 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+log_watermark(): Computes the latest timestamp the writer may merge up to.
+
+Parameters: log - A pointer to the log.
+
+Return value: The watermark, in microseconds.
+
+How it works:
+1. Starts from the current time: an event pushed after this point reads
+	the clock later, so it gets a later timestamp.
+2. Lowers it to the busy timestamp of every ring with an event on its way.
+*/
+static u_int64_t	log_watermark(t_log *log)
+{
+	u_int64_t	mark;
+	u_int64_t	busy;
+	int			i;
+
+	mark = get_time();
+	i = -1;
+	while (++i < log->n_rings)
+	{
+		busy = atomic_load(&log->rings[i].busy);
+		if (busy < mark)
+			mark = busy;
+	}
+	return (mark);
+}
+
+/*
+log_pop(): Takes the earliest event of all rings, if it is not past the
+			watermark.
+
+Parameters: log - A pointer to the log.
+            mark - The watermark.
+            ev - Where to copy the event.
+
+Return value: 1 if an event was taken, 0 otherwise.
+
+How it works:
+1. Looks at the oldest event of every ring and keeps the earliest one.
+	Each ring is in timestamp order, so this is a k-way merge.
+2. Copies it out and frees its slot by moving the ring's tail.
+*/
+static int	log_pop(t_log *log, u_int64_t mark, t_log_event *ev)
+{
+	t_ring		*best;
+	t_ring		*ring;
+	u_int64_t	tail;
+	int			i;
+
+	best = NULL;
+	i = -1;
+	while (++i < log->n_rings)
+	{
+		ring = &log->rings[i];
+		tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+		if (tail != atomic_load_explicit(&ring->head, memory_order_acquire)
+			&& ring->ev[tail % ring->size].ts <= mark && (!best
+				|| ring->ev[tail % ring->size].ts < ev->ts))
+		{
+			best = ring;
+			*ev = ring->ev[tail % ring->size];
+		}
+	}
+	if (!best)
+		return (0);
+	tail = atomic_load_explicit(&best->tail, memory_order_relaxed);
+	atomic_store_explicit(&best->tail, tail + 1, memory_order_release);
+	return (1);
+}
+
+/*
+log_emit(): Adds an event to the writer's output buffer.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            ev - The event.
+
+Return value: None.
+
+How it works:
+1. Drops the event if a death was already written: nothing follows "died".
+	A --sweep run only records it in its outcome.
+2. With --trace, records it in the trace; only a death is also printed.
+3. Flushes the buffer first if a line might not fit.
+4. Appends the line, formatted by log_format.
+5. A death is written out at once, and only then timed by death_note:
+	--death-report measures when "died" reaches stdout, not when it was
+	queued.
+*/
+static void	log_emit(t_data *data, t_log_event *ev)
+{
+	t_log	*log;
+
+	log = &data->log;
+	if (log->died)
+		return ;
+	if (data->opts.outcome)
+		outcome_record(data, ev);
+	if (!data->opts.outcome && log->trace.fd >= 0)
+		trace_record(&log->trace, ev->ts - pull_start_time(data),
+			ev->id, ev->msg);
+	if (!data->opts.outcome && (log->trace.fd < 0 || ev->msg == MSG_DIED))
+	{
+		if (log->buf_len + LOG_LINE_MAX > LOG_BUF_SIZE)
+			log_flush(log);
+		log->buf_len += log_format(log->buf + log->buf_len,
+				(ev->ts - pull_start_time(data)) / 1000, ev->id, ev->msg);
+	}
+	if (ev->msg != MSG_DIED)
+		return ;
+	log->died = 1;
+	log_flush(log);
+	death_note(data, ev->id - 1, 1);
+}
+
+/*
+log_flush(): Writes the writer's output buffer to stdout.
+
+Parameters: log - A pointer to the log.
+
+Return value: None.
+
+How it works:
+1. Writes the whole buffer in one write, and again from where it stopped
+	after a partial write or an interruption.
+2. Empties the buffer.
+*/
+void	log_flush(t_log *log)
+{
+	size_t	done;
+	ssize_t	written;
+
+	done = 0;
+	while (done < log->buf_len)
+	{
+		written = write(STDOUT_FILENO, log->buf + done, log->buf_len - done);
+		if (written == 0 || (written < 0 && errno != EINTR))
+			break ;
+		if (written > 0)
+			done += written;
+	}
+	log->buf_len = 0;
+}
+
+/*
+log_writer(): The writer thread's routine.
+
+Parameters: data_p - A void pointer to the data structure.
+			This is cast to a t_data pointer within the function.
+
+Return value: NULL.
+
+How it works:
+0. Reads the simulation's virtual clock, if it has one.
+1. Every LOG_FLUSH_US, merges the events of all rings up to the watermark
+	in timestamp order, and flushes them in one write.
+2. Updates the --metrics page, if any, every METRICS_PERIOD_US.
+3. Once log_stop() was called, every producer is done: drains all rings
+	without a watermark, flushes, and returns.
+*/
+void	*log_writer(void *data_p)
+{
+	t_data		*data;
+	t_log_event	ev;
+	u_int64_t	mark;
+	int			stop;
+
+	data = (t_data *)data_p;
+	virtual_bind(data->pool.vclock);
+	stop = 0;
+	while (!stop)
+	{
+		stop = atomic_load_explicit(&data->log.stop, memory_order_acquire);
+		mark = LOG_IDLE;
+		if (!stop)
+			mark = log_watermark(&data->log);
+		while (log_pop(&data->log, mark, &ev))
+			log_emit(data, &ev);
+		log_flush(&data->log);
+		metrics_publish(data, 0);
+		if (!stop)
+			usleep(LOG_FLUSH_US);
+	}
+	return (NULL);
+}
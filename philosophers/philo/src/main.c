@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:37:16 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:53:05 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+main():		Entry point of the program. It simulates the philosopher's problem.
+
+Parameters:	ac - The count of command-line arguments.
+			av - An array of the command-line arguments.
+
+Return value: 0 if the program runs successfully, 1 if there's an input error,
+				2 if there's an error in the philo function.
+
+How it works: 
+0. Extracts the --options from the command-line arguments using parse_opts,
+	and checks with proc_check that they can run with --processes.
+1. Checks the validity of the command-line arguments using input_check function,
+	unless they are --sweep ranges.
+	This function checks if the number of arguments is correct and if
+	all arguments are digits and within the valid range.
+2. If the arguments are invalid, it calls the print_error function to print an 
+	error message detailing the correct usage of the program and the valid range 
+	for each argument, and then returns 1.
+3. If the arguments are valid, it selects the clock source with clock_init,
+	warning if the TSC is unavailable, sets up ft_usleep with sleep_init
+	and the --death-report histograms with death_init,
+	then calls the philo function to simulate the 
+	philosopher's problem. This function creates a number of threads equal to the
+	number of philosophers, and each thread simulates a philosopher's life cycle.
+	With --sweep, the arguments are ranges: sweep_main checks them and runs
+	every combination instead, and its result is returned.
+4. If the philo function returns a non-zero value, indicating an error occurred 
+	during the simulation, the main function returns 2.
+5. If the philo function runs successfully, the main function returns 0.
+*/
+int	main(int ac, char **av)
+{
+	t_opts	opts;
+
+	if (parse_opts(&ac, av, &opts)
+		|| (!opts.sweep && input_check(ac, av, max_philos(&opts))))
+	{
+		print_error();
+		return (1);
+	}
+	if (opts.processes && proc_check(&opts))
+		return (1);
+	if (clock_init(opts.clock))
+		write(2, "philo: no invariant TSC, using CLOCK_MONOTONIC\n", 47);
+	sleep_init(opts.sleep_slack_us, opts.sleep_report && !opts.sweep);
+	death_init(opts.death_report);
+	if (opts.sweep)
+		return (sweep_main(ac, av, &opts));
+	if (opts.predict && predict_main(ac, av, &opts))
+		return (0);
+	if (philo(ac, av, &opts))
+		return (2);
+	return (0);
+}
@@ -0,0 +1,192 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   metrics.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:38:38 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:41:54 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+metrics_open(): Creates the --metrics page and maps it.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            path - The path of the file, e.g. under /dev/shm.
+
+Return value: 0 if the page is ready, 1 otherwise.
+
+How it works:
+1. Creates or truncates the file and sizes it for the header and one
+	entry per philosopher.
+2. Maps it shared, so stores to it are what philo_top sees, and closes
+	the file: the mapping keeps it.
+3. Fills in the header fields that never change, with an even seq.
+*/
+int	metrics_open(t_data *data, char *path)
+{
+	t_metrics	*m;
+	int			fd;
+
+	m = &data->log.metrics;
+	m->len = sizeof(t_metrics_hdr)
+		+ data->conf.n_philos * sizeof(t_metrics_philo);
+	fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return (1);
+	m->hdr = NULL;
+	if (ftruncate(fd, m->len) == 0)
+		m->hdr = mmap(NULL, m->len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (!m->hdr || m->hdr == MAP_FAILED)
+	{
+		m->hdr = NULL;
+		return (1);
+	}
+	m->hdr->magic = METRICS_MAGIC;
+	m->hdr->version = METRICS_VERSION;
+	m->hdr->n_philos = data->conf.n_philos;
+	m->hdr->running = 1;
+	m->hdr->us_todie = data->conf.us_todie;
+	return (0);
+}
+
+/*
+metrics_fill(): Copies every philosopher's state into the page.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            now - The time of the update.
+
+Return value: The number of meals eaten so far, by everyone.
+
+How it works:
+1. Loads each philosopher's meal word and meal count, with relaxed
+	loads: the writer only reads the philosophers' cache lines.
+2. Stores its state, its meals, and how long ago its last meal started.
+*/
+static u_int64_t	metrics_fill(t_data *data, u_int64_t now)
+{
+	t_metrics_philo	*p;
+	u_int64_t		word;
+	u_int64_t		meals;
+	int				i;
+
+	p = (t_metrics_philo *)(data->log.metrics.hdr + 1);
+	meals = 0;
+	i = -1;
+	while (++i < data->conf.n_philos)
+	{
+		word = atomic_load_explicit(&data->philo[i].hot->meal_word,
+				memory_order_relaxed);
+		p[i].state = word >> STATE_SHIFT;
+		p[i].meals = atomic_load_explicit(&data->philo[i].hot->n_meals,
+				memory_order_relaxed);
+		p[i].meal_age_us = 0;
+		if (now > (word & MEAL_MASK))
+			p[i].meal_age_us = now - (word & MEAL_MASK);
+		meals += p[i].meals;
+	}
+	return (meals);
+}
+
+/*
+metrics_totals(): Fills in the global figures of the page.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            meals - The number of meals eaten so far.
+            now - The time of the update.
+
+Return value: None.
+
+How it works:
+1. Stores the time since the start, the meals, and how late the death
+	monitor last woke up.
+2. Every METRICS_RATE_US, updates the meals per second over that time:
+	meals come in waves, one per meal time, which a shorter window would
+	show as bursts and gaps. The last update gives them over the whole
+	run instead.
+*/
+static void	metrics_totals(t_data *data, u_int64_t meals, u_int64_t now)
+{
+	t_metrics	*m;
+
+	m = &data->log.metrics;
+	if (m->last_at < data->conf.start_time || !m->hdr->running)
+		m->last_at = data->conf.start_time;
+	if (!m->hdr->running)
+		m->last_meals = 0;
+	m->hdr->elapsed_us = now - data->conf.start_time;
+	m->hdr->meals = meals;
+	m->hdr->monitor_lag_us = atomic_load_explicit(&data->dl.lag_us,
+			memory_order_relaxed);
+	if (m->hdr->running && now - m->last_at < METRICS_RATE_US)
+		return ;
+	m->hdr->meals_per_s = (meals - m->last_meals) * 1e6 / (now - m->last_at);
+	m->last_meals = meals;
+	m->last_at = now;
+}
+
+/*
+metrics_publish(): Updates the --metrics page under its seqlock.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            last - 1 for the final update, which clears running.
+
+Return value: None.
+
+How it works:
+1. Does nothing without a page, or before METRICS_PERIOD_US have passed
+	since the previous update, unless it is the last one. The log writer
+	calls it on every round, so only the writer updates the page.
+2. Makes seq odd, and orders that before the stores to the page.
+3. Fills the page with metrics_fill() and metrics_totals().
+4. Makes seq even again, releasing the stores to the readers.
+*/
+void	metrics_publish(t_data *data, int last)
+{
+	t_metrics	*m;
+	u_int64_t	now;
+
+	m = &data->log.metrics;
+	if (!m->hdr)
+		return ;
+	now = get_time();
+	if (!last && now < m->next)
+		return ;
+	atomic_fetch_add_explicit(&m->hdr->seq, 1, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+	m->hdr->running = !last;
+	metrics_totals(data, metrics_fill(data, now), now);
+	atomic_fetch_add_explicit(&m->hdr->seq, 1, memory_order_release);
+	m->next = now + METRICS_PERIOD_US;
+}
+
+/*
+metrics_close(): Publishes the final state and unmaps the page.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data, once the log writer has stopped.
+
+Return value: None.
+
+How it works:
+1. Publishes one last time with running cleared, so philo_top shows the
+	end of the simulation and stops. The file stays for a later look.
+2. Unmaps the page.
+*/
+void	metrics_close(t_data *data)
+{
+	if (!data->log.metrics.hdr)
+		return ;
+	metrics_publish(data, 1);
+	munmap(data->log.metrics.hdr, data->log.metrics.len);
+	data->log.metrics.hdr = NULL;
+}
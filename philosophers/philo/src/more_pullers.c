@@ -6,7 +6,7 @@
 /*   By: pmelis <pmelis@student.42wolfsburg.de>     +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2023/12/05 14:50:23 by pmelis            #+#    #+#             */
-/*   Updated: 2023/12/09 19:20:33 by pmelis           ###   ########.fr       */
+/*   Updated: 2026/10/18 01:46:55 by pmelis           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -20,19 +20,11 @@ Parameters: philo - A pointer to the philosopher structure.
 Return value: The number of meals the philosopher has had.
 
 How it works:
-1. Locks the mutex associated with the number of meals data of the philosopher.
-2. Reads the number of meals data of the philosopher.
-3. Unlocks the mutex.
-4. Returns the number of meals data.
+1. Atomically loads and returns the number of meals of the philosopher.
 */
 int	pull_n_meals_had(t_philo *philo)
 {
-	int	n_meals;
-
-	pthread_mutex_lock(&philo->n_meals_mu);
-	n_meals = philo->n_meals;
-	pthread_mutex_unlock(&philo->n_meals_mu);
-	return (n_meals);
+	return (atomic_load_explicit(&philo->hot->n_meals, memory_order_acquire));
 }
 
 /*
@@ -44,19 +36,12 @@ Parameters: data - A pointer to the data structure that holds
 Return value: The number of philosophers in the simulation.
 
 How it works:
-1. Locks the mutex associated with the number of philosophers data.
-2. Reads the number of philosophers data.
-3. Unlocks the mutex.
-4. Returns the number of philosophers data.
+1. Reads the value from the config block. It never changes once the threads
+	are running, so no lock is needed.
 */
 int	pull_n_philos(t_data *data)
 {
-	int	n_philos;
-
-	pthread_mutex_lock(&data->n_philos_mu);
-	n_philos = data->n_philos;
-	pthread_mutex_unlock(&data->n_philos_mu);
-	return (n_philos);
+	return (data->conf.n_philos);
 }
 
 /*
@@ -68,19 +53,11 @@ Parameters: data - A pointer to the data structure that holds
 Return value: The keep_iter flag of the simulation.
 
 How it works:
-1. Locks the mutex associated with the keep_iter data.
-2. Reads the keep_iter data.
-3. Unlocks the mutex.
-4. Returns the keep_iter data.
+1. Atomically loads and returns the keep_iter flag.
 */
 int	pull_keep_iter(t_data *data)
 {
-	int	keep_iter;
-
-	pthread_mutex_lock(&data->keep_iter_mu);
-	keep_iter = data->keep_iter;
-	pthread_mutex_unlock(&data->keep_iter_mu);
-	return (keep_iter);
+	return (atomic_load_explicit(&data->keep_iter, memory_order_acquire));
 }
 
 /*
@@ -91,17 +68,13 @@ Parameters: philo - A pointer to the philosopher structure.
 Return value: The state of the philosopher.
 
 How it works:
-1. Locks the mutex associated with the state data of the philosopher.
-2. Reads the state data of the philosopher.
-3. Unlocks the mutex.
-4. Returns the state data.
+1. Atomically loads the meal word of the philosopher.
+2. Returns the state stored in its top bits.
 */
 t_state	pull_philo_state(t_philo *philo)
 {
-	t_state	state;
+	u_int64_t	word;
 
-	pthread_mutex_lock(&philo->state_mu);
-	state = philo->state;
-	pthread_mutex_unlock(&philo->state_mu);
-	return (state);
+	word = atomic_load_explicit(&philo->hot->meal_word, memory_order_acquire);
+	return ((t_state)(word >> STATE_SHIFT));
 }
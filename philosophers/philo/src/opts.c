@@ -0,0 +1,158 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   opts.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:45:09 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 04:25:24 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+opt_value(): Matches a command-line option of the form --name=value.
+
+Parameters: arg - The command-line argument.
+            name - The name of the option, without the leading dashes.
+
+Return value: A pointer to the value if arg is --name=value, NULL otherwise.
+*/
+char	*opt_value(char *arg, char *name)
+{
+	int	i;
+
+	if (arg[0] != '-' || arg[1] != '-')
+		return (NULL);
+	i = 0;
+	while (name[i] && arg[i + 2] == name[i])
+		i++;
+	if (name[i] || arg[i + 2] != '=')
+		return (NULL);
+	return (&arg[i + 3]);
+}
+
+/*
+opt_flag(): Matches a command-line option of the form --name.
+
+Parameters: arg - The command-line argument.
+            name - The name of the option, without the leading dashes.
+
+Return value: 1 if arg is --name, 0 otherwise.
+*/
+int	opt_flag(char *arg, char *name)
+{
+	return (arg[0] == '-' && arg[1] == '-' && !strcmp(&arg[2], name));
+}
+
+/*
+parse_flag(): Parses one option without a value, or --metrics=<file>, into
+				the options structure.
+
+Parameters: arg - The command-line argument.
+            opts - A pointer to the options structure.
+
+Return value: 0 if the option is known and valid, 1 otherwise.
+*/
+static int	parse_flag(char *arg, t_opts *opts)
+{
+	if (opt_flag(arg, "predict") || opt_flag(arg, "predict-only"))
+		return (parse_predict(arg, opts));
+	if (opt_flag(arg, "virtual-time"))
+		return (parse_clock("virtual", opts));
+	if (opt_flag(arg, "sleep-report"))
+		opts->sleep_report = 1;
+	else if (opt_flag(arg, "fork-stats"))
+		opts->fork_stats = 1;
+	else if (opt_flag(arg, "processes"))
+		opts->processes = 1;
+	else if (opt_flag(arg, "death-report"))
+		opts->death_report = 1;
+	else if (opt_flag(arg, "stats"))
+		opts->stats = 1;
+	else if (opt_value(arg, "metrics") && *opt_value(arg, "metrics"))
+		opts->metrics = opt_value(arg, "metrics");
+	else
+		return (1);
+	return (0);
+}
+
+/*
+parse_opt(): Parses one option into the options structure.
+
+Parameters: arg - The command-line argument.
+            opts - A pointer to the options structure.
+
+Return value: 0 if the option is known and valid, 1 otherwise.
+
+How it works:
+1. Finds the option's name and hands its value to that option's parser.
+	Options that may go without a value are parsed here too.
+2. Hands the other options to parse_flag(), which rejects unknown ones.
+*/
+int	parse_opt(char *arg, t_opts *opts)
+{
+	if (opt_value(arg, "layout"))
+		return (parse_layout(opt_value(arg, "layout"), opts));
+	if (opt_value(arg, "clock"))
+		return (parse_clock(opt_value(arg, "clock"), opts));
+	if (opt_value(arg, "sleep-slack"))
+		return (parse_uint(opt_value(arg, "sleep-slack"), 1000000,
+				&opts->sleep_slack_us));
+	if (opt_value(arg, "trace"))
+		opts->trace = opt_value(arg, "trace");
+	if (opt_value(arg, "trace"))
+		return (*opts->trace == '\0');
+	if (opt_value(arg, "workers") || opt_flag(arg, "pool")
+		|| opt_flag(arg, "coroutines"))
+		return (parse_pool(arg, opts));
+	if (opt_value(arg, "sweep") || opt_flag(arg, "sweep"))
+		return (parse_sweep(arg, opts));
+	if (opt_value(arg, "forks"))
+		return (parse_forks(opt_value(arg, "forks"), opts));
+	if (opt_value(arg, "fork-lock"))
+		return (parse_fork_lock(opt_value(arg, "fork-lock"), opts));
+	return (parse_flag(arg, opts));
+}
+
+/*
+parse_opts(): Extracts the options from the command-line arguments.
+
+Parameters: ac - A pointer to the count of command-line arguments.
+            av - An array of the command-line arguments.
+            opts - A pointer to the options structure to fill.
+
+Return value: 0 if all options are valid, 1 otherwise.
+
+How it works:
+1. Sets every option to its default.
+2. Parses each argument starting with "--" and removes it from av,
+	so that input_check() only sees the positional arguments.
+3. Rejects the options that cannot be used together with opts_check.
+*/
+int	parse_opts(int *ac, char **av, t_opts *opts)
+{
+	int	i;
+	int	j;
+
+	memset(opts, 0, sizeof(t_opts));
+	opts->layout = LAYOUT_PADDED;
+	opts->clock = CLOCK_SRC_MONO;
+	i = 1;
+	j = 1;
+	while (i < *ac)
+	{
+		if (av[i][0] == '-' && av[i][1] == '-')
+		{
+			if (parse_opt(av[i++], opts))
+				return (1);
+		}
+		else
+			av[j++] = av[i++];
+	}
+	*ac = j;
+	av[j] = NULL;
+	return (opts_check(opts));
+}
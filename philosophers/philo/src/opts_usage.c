@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   opts_usage.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:44:37 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 04:25:39 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+print_run_opts(): Prints the options that change how the table is run.
+
+Parameters: None.
+
+Return value: None.
+*/
+static void	print_run_opts(void)
+{
+	printf("--workers=<n>: run the philosophers as tasks on n worker threads, "
+		"which allows up to %d philosophers\n", POOL_MAX_PHILOS);
+	printf("--pool: same as --workers=<number of online cores>\n");
+	printf("--coroutines: run every philosopher as a coroutine on a single "
+		"scheduler thread, with the same limit as --workers\n");
+	printf("--forks=order|waiter|chandy|ticket|hunger: how a philosopher "
+		"thread gets its forks: alternating order (default), a central "
+		"waiter, Chandy-Misra dirty/clean forks, n - 1 tickets served in "
+		"order, or alternating order with contested forks going to the "
+		"hungrier neighbour\n");
+	printf("--fork-lock=mutex|ticket|mcs|adaptive|handoff: the lock of a "
+		"fork taken in order: pthread mutex (default), FIFO ticket lock, "
+		"MCS queue lock, spinning while the holder's meal ends, or handed "
+		"straight to the waiting neighbour\n");
+	printf("--fork-stats: print the meals per second, the time spent "
+		"waiting for forks and Jain's fairness index on stderr at exit\n");
+	printf("--sweep[=csv|json]: every argument is a range lo[:hi[:step]]; "
+		"run every combination, %d meals unless given, in parallel and "
+		"print one row per run\n", SWEEP_MEALS);
+	printf("--predict: print the outcome expected from the arguments on "
+		"stderr before the run; with --sweep, do not run those expected "
+		"to die\n");
+	printf("--predict-only: print the expected outcome instead of "
+		"running\n\n");
+}
+
+/*
+print_opts(): Prints the available options.
+
+Parameters: None.
+
+Return value: None.
+*/
+void	print_opts(void)
+{
+	printf("options:\n");
+	printf("--layout=padded|packed: hot data and forks one per cache line "
+		"(default) or back to back\n");
+	printf("--clock=mono|tsc|virtual: CLOCK_MONOTONIC (default), calibrated "
+		"invariant TSC, or simulated time\n");
+	printf("--virtual-time: same as --clock=virtual: simulate the table in "
+		"virtual time, without sleeping\n");
+	printf("--sleep-slack=<us>: time ft_usleep spends yielding before a "
+		"deadline (default: calibrated)\n");
+	printf("--sleep-report: print the overshoot of every sleep on stderr\n");
+	printf("--death-report: print how long after their deadline deaths "
+		"were printed and near-misses noticed on stderr at exit\n");
+	printf("--stats: print every philosopher's fork waits, meal and sleep "
+		"times and least slack before its deadline on stderr at exit\n");
+	printf("--trace=<file>: record every state change in a binary trace "
+		"instead of printing it (decode with philo_trace)\n");
+	printf("--metrics=<file>: publish live metrics in a shared page "
+		"(watch with philo_top <file>)\n");
+	printf("--processes: run every philosopher as a forked child, with the "
+		"forks and the log in shared memory and the parent as supervisor\n");
+	print_run_opts();
+}
+
+/*
+opts_check(): Rejects the options that cannot be used together.
+
+Parameters: opts - A pointer to the parsed options.
+
+Return value: 0 if they can, 1 otherwise, after printing why.
+
+How it works:
+1. The Chandy-Misra and hunger strategies hand their forks out their own
+	way: a --fork-lock other than the default would be ignored. The order,
+	waiter and ticket strategies take each fork with fork_lock().
+2. The worker pool, the coroutines and the virtual clock run the
+	philosophers as tasks, which cannot block: only the order strategy
+	with the default lock runs there, see pfork_take().
+*/
+int	opts_check(t_opts *opts)
+{
+	if ((opts->forks == FORKS_CHANDY || opts->forks == FORKS_HUNGER)
+		&& opts->fork_lock != LOCK_MUTEX)
+	{
+		write(2, "philo: --fork-lock does not apply to --forks=chandy "
+			"or hunger\n", 62);
+		return (1);
+	}
+	if ((opts->forks != FORKS_ORDER || opts->fork_lock != LOCK_MUTEX)
+		&& (opts->workers || opts->coroutines
+			|| opts->clock == CLOCK_SRC_VIRTUAL))
+	{
+		write(2, "philo: --forks and --fork-lock need a thread per "
+			"philosopher\n", 61);
+		return (1);
+	}
+	return (0);
+}
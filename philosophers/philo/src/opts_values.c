@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   opts_values.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:47:50 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 02:30:53 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+parse_layout(): Parses the value of --layout.
+
+Parameters: val - The value of the option.
+            opts - A pointer to the options structure.
+
+Return value: 0 if the value is padded or packed, 1 otherwise.
+*/
+int	parse_layout(char *val, t_opts *opts)
+{
+	if (!strcmp(val, "padded"))
+		opts->layout = LAYOUT_PADDED;
+	else if (!strcmp(val, "packed"))
+		opts->layout = LAYOUT_PACKED;
+	else
+		return (1);
+	return (0);
+}
+
+/*
+parse_clock(): Parses the value of --clock.
+
+Parameters: val - The value of the option.
+            opts - A pointer to the options structure.
+
+Return value: 0 if the value is mono, tsc or virtual, 1 otherwise.
+*/
+int	parse_clock(char *val, t_opts *opts)
+{
+	if (!strcmp(val, "mono"))
+		opts->clock = CLOCK_SRC_MONO;
+	else if (!strcmp(val, "tsc"))
+		opts->clock = CLOCK_SRC_TSC;
+	else if (!strcmp(val, "virtual"))
+		opts->clock = CLOCK_SRC_VIRTUAL;
+	else
+		return (1);
+	return (0);
+}
+
+/*
+parse_uint(): Parses an unsigned decimal option value.
+
+Parameters: val - The value of the option.
+            max - The largest accepted value.
+            out - Where to store the parsed value.
+
+Return value: 0 if val is a decimal number no greater than max, 1 otherwise.
+*/
+int	parse_uint(char *val, u_int64_t max, u_int64_t *out)
+{
+	u_int64_t	n;
+	int			i;
+
+	n = 0;
+	i = 0;
+	while (val[i] >= '0' && val[i] <= '9' && n <= max)
+		n = n * 10 + (val[i++] - '0');
+	if (i == 0 || val[i] || n > max)
+		return (1);
+	*out = n;
+	return (0);
+}
+
+/*
+parse_pool(): Parses --workers=<n>, --pool and --coroutines.
+
+Parameters: arg - The command-line argument.
+            opts - A pointer to the options structure.
+
+Return value: 0 if the number of workers is valid, 1 otherwise.
+
+How it works:
+1. --workers=<n> takes between 1 and POOL_MAX_WORKERS workers.
+2. --pool takes one worker per online core, capped the same way.
+3. --coroutines only sets its flag: data_init() gives it one worker, the
+	scheduler, whatever --workers says.
+*/
+int	parse_pool(char *arg, t_opts *opts)
+{
+	long	n;
+
+	if (opt_flag(arg, "coroutines"))
+		opts->coroutines = 1;
+	if (opt_flag(arg, "coroutines"))
+		return (0);
+	if (opt_value(arg, "workers"))
+		return (parse_uint(opt_value(arg, "workers"), POOL_MAX_WORKERS,
+				&opts->workers) || opts->workers == 0);
+	n = sysconf(_SC_NPROCESSORS_ONLN);
+	if (n < 1)
+		n = 1;
+	if (n > POOL_MAX_WORKERS)
+		n = POOL_MAX_WORKERS;
+	opts->workers = n;
+	return (0);
+}
+
+/*
+max_philos(): Gives the largest table the chosen mode can seat.
+
+Parameters: opts - A pointer to the parsed options.
+
+Return value: POOL_MAX_PHILOS with a worker pool, with coroutines or in
+				virtual time, 200 otherwise.
+*/
+int	max_philos(t_opts *opts)
+{
+	if (opts->workers || opts->coroutines
+		|| opts->clock == CLOCK_SRC_VIRTUAL)
+		return (POOL_MAX_PHILOS);
+	return (200);
+}
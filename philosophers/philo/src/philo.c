@@ -6,12 +6,49 @@
 /*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2023/12/04 20:52:22 by pmelis            #+#    #+#             */
-/*   Updated: 2023/12/09 20:42:53 by pmelis           ###   ########.fr       */
+/*   Updated: 2026/10/18 04:24:17 by pmelis           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../include/philo.h"
 
+/*
+philo_setup(): Initializes the philosophers, their forks and the --forks
+				strategy, and the worker pool, the coroutines, the
+				trace file and the --metrics page when they are used.
+
+Parameters: data - A pointer to the data structure that holds the simulation
+					data.
+
+Return value: 0 on success, 1 if the strategy, the pool, the trace or the
+				metrics page cannot be set up.
+*/
+static int	philo_setup(t_data *data)
+{
+	philo_init(data);
+	fork_init(data);
+	if (strategy_init(data))
+		return (1);
+	if (data->conf.n_workers && (pool_init(data)
+			|| (data->opts.coroutines && co_init(data))
+			|| (data->opts.clock == CLOCK_SRC_VIRTUAL && des_init(data))))
+	{
+		write(2, "philo: cannot create the worker pool\n", 37);
+		return (1);
+	}
+	if (data->opts.trace && trace_open(&data->log.trace, data->opts.trace))
+	{
+		write(2, "philo: cannot create the trace file\n", 36);
+		return (1);
+	}
+	if (data->opts.metrics && metrics_open(data, data->opts.metrics))
+	{
+		write(2, "philo: cannot create the metrics page\n", 38);
+		return (1);
+	}
+	return (0);
+}
+
 /*
 run_threads():		Creates and runs threads for each philosopher.
 
@@ -23,16 +60,24 @@ Return value: 0 if the threads are created and run successfully,
 
 How it works: 
 1. Retrieves the number of philosophers from the data structure.
-2. Records the start time of the simulation.
-3. Creates a thread for each philosopher using pthread_create. 
+2. Records the start time of the simulation in the config block. This is
+	its last write: pthread_create publishes the block to every thread.
+3. With --processes, forks the philosophers and starts the parent's
+	threads with proc_start and returns. Otherwise starts the log writer
+	thread. With --virtual-time, runs the whole simulation right here
+	with des_run and returns.
+4. Creates a thread for each philosopher using pthread_create. 
 	Each thread runs the routine function, simulating a philosopher's life cycle.
-4. Creates a thread that runs the all_alive_routine function, 
+	With --workers, starts the worker pool instead, which runs the
+	philosophers as tasks, and with --coroutines the scheduler thread,
+	which runs them as coroutines.
+5. Creates a thread that runs the all_alive_routine function, 
 	which checks if all philosophers are alive.
-5. If the number of meals is specified, creates a thread that runs 
+6. If the number of meals is specified, creates a thread that runs 
 	the all_full_routine function, which checks if all philosophers 
 	have eaten the specified number of meals.
-6. If any thread is not created successfully, returns 1.
-7. If all threads are created and run successfully, returns 0.
+7. If any thread is not created successfully, returns 1.
+8. If all threads are created and run successfully, returns 0.
 */
 int	run_threads(t_data *data)
 {
@@ -41,8 +86,16 @@ int	run_threads(t_data *data)
 
 	i = -1;
 	n_philos = pull_n_philos(data);
-	data->start_time = get_time();
-	while (++i < n_philos)
+	data->conf.start_time = get_time();
+	if (data->opts.processes)
+		return (proc_start(data));
+	if (log_start(data))
+		return (1);
+	if (data->opts.clock == CLOCK_SRC_VIRTUAL)
+		return (des_run(data));
+	if (data->conf.n_workers && pool_start(data))
+		return (1);
+	while (!data->conf.n_workers && ++i < n_philos)
 	{
 		if (pthread_create(&data->philo_th[i], NULL, &routine, &data->philo[i]))
 			return (1);
@@ -64,31 +117,41 @@ Parameters: data - A pointer to the data structure that holds
 Return value: 0 if all threads finish successfully, 1 if there's an error.
 
 How it works: 
-1. Retrieves the number of philosophers from the data structure.
+1. With --processes, supervises and reaps the children with proc_join.
 2. Waits for the all_alive_routine thread to finish using the pthread_join
 	function.
 3. If the number of meals is specified, waits for the all_full_routine thread
 	to finish.
-4. Waits for each philosopher's thread to finish.
-5. If any thread does not finish successfully, returns 1.
-6. If all threads finish successfully, returns 0.
+4. Waits for each philosopher's thread, or each pool worker, to finish.
+	With --virtual-time, the simulation is over already and there are no
+	threads left: skips to 5.
+5. Stops the log writer thread, which prints the remaining events, then
+	prints the --stats table, once every philosopher has stopped writing
+	its counters.
+6. If any thread does not finish successfully, returns 1.
+7. If all threads finish successfully, returns 0.
 */
 int	join_threads(t_data *data)
 {
 	int	i;
-	int	n_philos;
 
 	i = -1;
-	n_philos = pull_n_philos(data);
-	if (pthread_join(data->monit_all_alive, NULL))
-		return (1);
-	if (n_meal_trigger(data) && pthread_join(data->monit_all_full, NULL))
+	if (data->opts.processes)
+		return (proc_join(data));
+	if (data->opts.clock != CLOCK_SRC_VIRTUAL
+		&& (pthread_join(data->monit_all_alive, NULL) || (n_meal_trigger(data)
+				&& pthread_join(data->monit_all_full, NULL))))
 		return (1);
-	while (++i < n_philos)
+	if (data->conf.n_workers && data->opts.clock != CLOCK_SRC_VIRTUAL)
+		pool_join(data);
+	while (!data->conf.n_workers && ++i < data->conf.n_philos)
 	{
 		if (pthread_join(data->philo_th[i], NULL))
 			return (1);
 	}
+	log_stop(data);
+	if (data->opts.stats)
+		stats_report(data);
 	return (0);
 }
 
@@ -97,65 +160,52 @@ philo(): Simulates the philosopher's problem.
 
 Parameters: ac - The count of command-line arguments.
             av - An array of the command-line arguments.
+            opts - A pointer to the options parsed from the command line.
 
 Return value: 0 if the simulation runs successfully, 2 if there's an error.
 
 How it works: 
+0. Puts the data structure on the stack or, with --processes, at the
+	start of the shared mapping made by proc_map, and copies the options
+	into it.
 1. Initializes the data structure using the data_init function.
 2. If the data structure is not initialized correctly, returns 2.
-3. Initializes the philosophers using the philo_init function.
-4. Initializes the forks using the fork_init function.
+3. Initializes the philosophers, the forks, the worker pool and the trace
+	with philo_setup. If that fails, frees everything and returns 2.
 5. Runs the simulation by creating and running threads using the run_threads
 	function.
-6. Waits for all threads to finish using the join_threads function.
-7. Frees the allocated memory using the free_data function.
+6. Waits for all threads to finish using the join_threads function,
+	then prints the fork, sleep and death reports if they were requested.
+	A --sweep prints the death report once, over all its runs.
+7. Frees the allocated memory using the free_data function. With
+	--processes, that unmaps the shared mapping, data structure included.
 8. If the simulation runs successfully, returns 0.
 */
-int	philo(int ac, char **av)
+int	philo(int ac, char **av, t_opts *opts)
 {
-	t_data	data;
+	t_data	local;
+	t_data	*data;
 
-	if (data_init(&data, ac, av))
+	data = &local;
+	if (opts->processes)
+		data = proc_map(ft_atoi(av[1]));
+	if (!data)
 		return (2);
-	philo_init(&data);
-	fork_init(&data);
-	run_threads(&data);
-	join_threads(&data);
-	free_data(&data);
-	return (0);
-}
-
-/*
-main():		Entry point of the program. It simulates the philosopher's problem.
-
-Parameters:	ac - The count of command-line arguments.
-			av - An array of the command-line arguments.
-
-Return value: 0 if the program runs successfully, 1 if there's an input error,
-				2 if there's an error in the philo function.
-
-How it works: 
-1. Checks the validity of the command-line arguments using input_check function.
-	This function checks if the number of arguments is correct and if
-	all arguments are digits and within the valid range.
-2. If the arguments are invalid, it calls the print_error function to print an 
-	error message detailing the correct usage of the program and the valid range 
-	for each argument, and then returns 1.
-3. If the arguments are valid, it calls the philo function to simulate the 
-	philosopher's problem. This function creates a number of threads equal to the
-	number of philosophers, and each thread simulates a philosopher's life cycle.
-4. If the philo function returns a non-zero value, indicating an error occurred 
-	during the simulation, the main function returns 2.
-5. If the philo function runs successfully, the main function returns 0.
-*/
-int	main(int ac, char **av)
-{
-	if (input_check(ac, av))
+	data->opts = *opts;
+	if (data_init(data, ac, av))
+		return (2);
+	if (philo_setup(data))
 	{
-		print_error();
-		return (1);
-	}
-	if (philo(ac, av))
+		free_data(data);
 		return (2);
+	}
+	run_threads(data);
+	join_threads(data);
+	if (data->opts.fork_stats)
+		forks_report(data);
+	sleep_report();
+	if (!opts->sweep)
+		death_report();
+	free_data(data);
 	return (0);
 }
@@ -0,0 +1,163 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pool.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:12:14 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 04:08:09 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+worker_init(): Initializes one worker.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            id - The index of the worker.
+            cap - The initial capacity of its run queue and timer heap.
+
+Return value: 0 on success, 1 if memory cannot be allocated.
+
+How it works:
+1. Initializes the mutex, and a condition variable that times out on
+	CLOCK_MONOTONIC, like the death monitor's.
+2. Allocates the run queue and the timer heap. They grow as needed.
+*/
+static int	worker_init(t_data *data, int id, int cap)
+{
+	pthread_condattr_t	attr;
+	t_worker			*w;
+
+	w = &data->pool.workers[id];
+	memset(w, 0, sizeof(t_worker));
+	w->id = id;
+	w->data = data;
+	pthread_mutex_init(&w->mu, NULL);
+	pthread_condattr_init(&attr);
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	pthread_cond_init(&w->cv, &attr);
+	pthread_condattr_destroy(&attr);
+	w->q_cap = cap;
+	w->t_cap = cap;
+	w->queue = malloc(sizeof(int) * cap);
+	w->timers = malloc(sizeof(t_dl_node) * cap);
+	return (!w->queue || !w->timers);
+}
+
+/*
+pool_init(): Builds the worker pool and hands out the philosophers.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: 0 on success, 1 if memory cannot be allocated.
+
+How it works:
+1. Allocates the workers and the task steps, and initializes every
+	worker, even after a failure, so pool_free() can always clean up.
+	Keeps the caller's virtual clock for the threads of the simulation.
+2. Starts every task at STEP_START, in the run queue of the worker that
+	owns its segment of the table, so neighbours share a worker.
+*/
+int	pool_init(t_data *data)
+{
+	int	i;
+	int	n;
+	int	err;
+
+	n = data->conf.n_philos;
+	data->pool.resume = &pool_resume;
+	data->pool.vclock = virtual_clock();
+	atomic_init(&data->pool.n_idle, 0);
+	data->pool.steps = malloc(sizeof(t_step) * n);
+	data->pool.workers = aligned_alloc(CACHE_LINE,
+			sizeof(t_worker) * data->conf.n_workers);
+	if (!data->pool.workers)
+		return (1);
+	err = !data->pool.steps;
+	i = -1;
+	while (++i < data->conf.n_workers)
+		err |= worker_init(data, i, n / data->conf.n_workers + 16);
+	i = -1;
+	while (!err && ++i < n)
+	{
+		data->pool.steps[i] = STEP_START;
+		queue_push(&data->pool.workers[pool_owner(data, i)], i);
+	}
+	return (err);
+}
+
+/*
+pool_start(): Creates the worker threads, or the coroutine scheduler's.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: 0 if every thread is created, 1 otherwise.
+*/
+int	pool_start(t_data *data)
+{
+	int	i;
+
+	if (data->opts.coroutines)
+		return (pthread_create(&data->pool.workers[0].th, NULL, &co_routine,
+				data) != 0);
+	i = -1;
+	while (++i < data->conf.n_workers)
+	{
+		if (pthread_create(&data->pool.workers[i].th, NULL, &worker_routine,
+				&data->pool.workers[i]))
+			return (1);
+	}
+	return (0);
+}
+
+/*
+pool_join(): Waits for every worker thread to finish.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: None.
+*/
+void	pool_join(t_data *data)
+{
+	int	i;
+
+	i = -1;
+	while (++i < data->conf.n_workers)
+		pthread_join(data->pool.workers[i].th, NULL);
+}
+
+/*
+pool_free(): Destroys the workers and frees the pool and the coroutines.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: None.
+*/
+void	pool_free(t_data *data)
+{
+	int	i;
+
+	i = -1;
+	while (data->pool.workers && ++i < data->conf.n_workers)
+	{
+		pthread_mutex_destroy(&data->pool.workers[i].mu);
+		pthread_cond_destroy(&data->pool.workers[i].cv);
+		free(data->pool.workers[i].queue);
+		free(data->pool.workers[i].timers);
+		free(data->pool.workers[i].pend);
+		if (data->pool.workers[i].dl.heap)
+			dl_destroy(&data->pool.workers[i].dl);
+	}
+	free(data->pool.workers);
+	free(data->pool.steps);
+	free(data->pool.want);
+	co_free(data);
+}
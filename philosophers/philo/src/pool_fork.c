@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pool_fork.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:11:01 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 04:08:09 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+pfork_take(): Takes a fork without blocking.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            i - The index of the philosopher taking the fork.
+            fork - A pointer to the fork.
+
+Return value: 1 if the fork is now held, 0 if it is taken: the caller is
+				then registered as its waiter and must park.
+
+How it works:
+1. In virtual time, leaves it to des_take().
+2. Swaps FORK_FREE for FORK_TAKEN.
+3. If the fork is taken, swaps FORK_TAKEN for FORK_WAITED instead. Only the
+	other neighbour of the holder can wait for a fork, so one flag is
+	enough to know whom to resume. If the fork was dropped in the
+	meantime, tries to take it again.
+*/
+int	pfork_take(t_data *data, int i, t_fork *fork)
+{
+	int	state;
+
+	if (data->opts.clock == CLOCK_SRC_VIRTUAL)
+		return (des_take(data, i, fork));
+	state = FORK_FREE;
+	while (1)
+	{
+		if (state == FORK_FREE && atomic_compare_exchange_weak(&fork->state,
+				&state, FORK_TAKEN))
+			return (1);
+		if (state == FORK_WAITED)
+			return (0);
+		if (state == FORK_TAKEN && atomic_compare_exchange_weak(&fork->state,
+				&state, FORK_WAITED))
+			return (0);
+	}
+}
+
+/*
+pfork_drop(): Drops a fork and resumes the neighbour waiting for it.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            i - The index of the philosopher dropping the fork.
+            fork - A pointer to the fork.
+
+Return value: None.
+
+How it works:
+1. In virtual time, leaves it to des_drop().
+2. Sets the fork free.
+3. If it was FORK_WAITED, resumes the other philosopher sharing it: fork
+	i is the left fork of philosopher i and the right fork of philosopher
+	i + 1, as fork_init() sets them.
+*/
+void	pfork_drop(t_data *data, int i, t_fork *fork)
+{
+	int	n;
+
+	if (data->opts.clock == CLOCK_SRC_VIRTUAL)
+	{
+		des_drop(data, i, fork);
+		return ;
+	}
+	if (atomic_exchange(&fork->state, FORK_FREE) != FORK_WAITED)
+		return ;
+	n = pull_n_philos(data);
+	if (fork == data->philo[i].left_f)
+		data->pool.resume(data, (i + 1) % n);
+	else
+		data->pool.resume(data, (i + n - 1) % n);
+}
+
+/*
+pool_owner(): Finds the worker that owns a philosopher.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            i - The index of the philosopher.
+
+Return value: The index of the worker.
+
+How it works:
+1. Cuts the table into one contiguous segment per worker, of sizes that
+	differ by one at most, so only the forks between two segments are
+	shared by two workers.
+*/
+int	pool_owner(t_data *data, int i)
+{
+	return ((int)((u_int64_t)i * data->conf.n_workers / data->conf.n_philos));
+}
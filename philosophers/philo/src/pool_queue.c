@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pool_queue.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:11:17 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 02:16:35 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+queue_grow(): Doubles the capacity of a worker's run queue.
+
+Parameters: w - A pointer to the worker, whose mutex is held.
+
+Return value: 0 if the queue grew, 1 if memory cannot be allocated.
+
+How it works:
+1. Copies the queued tasks, oldest first, to the start of a new array of
+	twice the capacity.
+*/
+static int	queue_grow(t_worker *w)
+{
+	int	*queue;
+	int	i;
+
+	queue = malloc(sizeof(int) * w->q_cap * 2);
+	if (!queue)
+		return (1);
+	i = -1;
+	while (++i < w->q_len)
+		queue[i] = w->queue[(w->q_head + i) % w->q_cap];
+	free(w->queue);
+	w->queue = queue;
+	w->q_head = 0;
+	w->q_cap *= 2;
+	return (0);
+}
+
+/*
+queue_push(): Appends a ready task to a worker's run queue.
+
+Parameters: w - A pointer to the worker.
+            i - The index of the philosopher.
+
+Return value: 0 if the task is queued, 1 if memory cannot be allocated.
+*/
+int	queue_push(t_worker *w, int i)
+{
+	int	ret;
+
+	ret = 0;
+	pthread_mutex_lock(&w->mu);
+	if (w->q_len == w->q_cap)
+		ret = queue_grow(w);
+	if (!ret)
+		w->queue[(w->q_head + w->q_len++) % w->q_cap] = i;
+	pthread_mutex_unlock(&w->mu);
+	return (ret);
+}
+
+/*
+queue_pop(): Takes the oldest task of a worker's own run queue.
+
+Parameters: w - A pointer to the worker.
+            i - Where to store the index of the philosopher.
+
+Return value: 1 if a task was taken, 0 if the queue is empty.
+
+How it works:
+1. The owner takes tasks first in, first out, so philosophers resumed
+	when a fork was dropped get it in the order they were resumed.
+*/
+int	queue_pop(t_worker *w, int *i)
+{
+	int	ret;
+
+	pthread_mutex_lock(&w->mu);
+	ret = (w->q_len > 0);
+	if (ret)
+	{
+		*i = w->queue[w->q_head];
+		w->q_head = (w->q_head + 1) % w->q_cap;
+		w->q_len--;
+	}
+	pthread_mutex_unlock(&w->mu);
+	return (ret);
+}
+
+/*
+queue_steal(): Takes the newest task of another worker's run queue.
+
+Parameters: w - A pointer to the worker to steal from.
+            i - Where to store the index of the philosopher.
+
+Return value: 1 if a task was stolen, 0 if the queue is empty or busy.
+
+How it works:
+1. Only tries the lock, so an idle worker never waits behind the owner.
+2. Steals from the other end than the owner pops from.
+*/
+static int	queue_steal(t_worker *w, int *i)
+{
+	int	ret;
+
+	if (pthread_mutex_trylock(&w->mu) != 0)
+		return (0);
+	ret = (w->q_len > 0);
+	if (ret)
+		*i = w->queue[(w->q_head + --w->q_len) % w->q_cap];
+	pthread_mutex_unlock(&w->mu);
+	return (ret);
+}
+
+/*
+queue_steal_any(): Steals a task from the other workers' run queues.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            w - A pointer to the idle worker.
+            i - Where to store the index of the philosopher.
+
+Return value: 1 if a task was stolen, 0 otherwise.
+
+How it works:
+1. Tries every other worker once, starting with the next one, so idle
+	workers do not all go for the same victim.
+*/
+int	queue_steal_any(t_data *data, t_worker *w, int *i)
+{
+	int	n;
+	int	k;
+
+	n = data->conf.n_workers;
+	k = 0;
+	while (++k < n)
+	{
+		if (queue_steal(&data->pool.workers[(w->id + k) % n], i))
+			return (1);
+	}
+	return (0);
+}
@@ -0,0 +1,145 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pool_timer.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:11:17 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 02:16:35 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+timer_sift_up(): Moves a timer towards the root while it is due earlier
+					than its parent.
+
+Parameters: w - A pointer to the worker.
+            i - The index of the timer.
+
+Return value: None.
+*/
+static void	timer_sift_up(t_worker *w, int i)
+{
+	t_dl_node	tmp;
+
+	while (i > 0 && w->timers[i].key < w->timers[(i - 1) / 2].key)
+	{
+		tmp = w->timers[i];
+		w->timers[i] = w->timers[(i - 1) / 2];
+		w->timers[(i - 1) / 2] = tmp;
+		i = (i - 1) / 2;
+	}
+}
+
+/*
+timer_sift_down(): Moves the root timer towards the leaves while one of
+					its children is due earlier.
+
+Parameters: w - A pointer to the worker.
+
+Return value: None.
+*/
+static void	timer_sift_down(t_worker *w)
+{
+	t_dl_node	tmp;
+	int			i;
+	int			min;
+
+	i = 0;
+	while (1)
+	{
+		min = i;
+		if (2 * i + 1 < w->n_timers
+			&& w->timers[2 * i + 1].key < w->timers[min].key)
+			min = 2 * i + 1;
+		if (2 * i + 2 < w->n_timers
+			&& w->timers[2 * i + 2].key < w->timers[min].key)
+			min = 2 * i + 2;
+		if (min == i)
+			return ;
+		tmp = w->timers[i];
+		w->timers[i] = w->timers[min];
+		w->timers[min] = tmp;
+		i = min;
+	}
+}
+
+/*
+timer_push(): Parks a task in its worker's timer heap.
+
+Parameters: w - A pointer to the worker. Only its own thread uses the heap.
+            wake - The time to resume the task at, in microseconds.
+            i - The index of the philosopher.
+
+Return value: 0 if the task is parked, 1 if memory cannot be allocated.
+
+How it works:
+1. Doubles the heap when it is full, then inserts the timer.
+*/
+int	timer_push(t_worker *w, u_int64_t wake, int i)
+{
+	t_dl_node	*timers;
+
+	if (w->n_timers == w->t_cap)
+	{
+		timers = malloc(sizeof(t_dl_node) * w->t_cap * 2);
+		if (!timers)
+			return (1);
+		memcpy(timers, w->timers, sizeof(t_dl_node) * w->n_timers);
+		free(w->timers);
+		w->timers = timers;
+		w->t_cap *= 2;
+	}
+	w->timers[w->n_timers].key = wake;
+	w->timers[w->n_timers].philo = i;
+	timer_sift_up(w, w->n_timers++);
+	return (0);
+}
+
+/*
+timer_pop(): Takes the earliest timer of a worker if it is due.
+
+Parameters: w - A pointer to the worker.
+            now - The current time, in microseconds.
+            i - Where to store the index of the philosopher.
+
+Return value: 1 if a due timer was taken, 0 otherwise.
+*/
+int	timer_pop(t_worker *w, u_int64_t now, int *i)
+{
+	if (w->n_timers == 0 || w->timers[0].key > now)
+		return (0);
+	*i = w->timers[0].philo;
+	w->timers[0] = w->timers[--w->n_timers];
+	timer_sift_down(w);
+	return (1);
+}
+
+/*
+timer_expire(): Moves every due timer of a worker to its run queue.
+
+Parameters: w - A pointer to the worker.
+
+Return value: 0 on success, 1 if the run queue cannot grow.
+
+How it works:
+1. Pops the due timers in deadline order and queues them behind the tasks
+	already ready, so a task resumed by a dropped fork is not starved by
+	a stream of timers falling due.
+*/
+int	timer_expire(t_worker *w)
+{
+	u_int64_t	now;
+	int			i;
+
+	now = get_time();
+	while (timer_pop(w, now, &i))
+	{
+		if (queue_push(w, i))
+			return (1);
+	}
+	return (0);
+}
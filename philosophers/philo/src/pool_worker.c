@@ -0,0 +1,176 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pool_worker.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:12:00 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 02:30:53 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+static _Thread_local t_worker	*g_worker;
+
+/*
+task_run(): Runs one step of a task and files it for what it waits for.
+
+Parameters: w - A pointer to the worker running the task.
+            i - The index of the philosopher.
+
+Return value: None.
+
+How it works:
+1. Runs task_step.
+2. A ready task goes back to the run queue, a task waiting for a time to
+	the timer heap. Parked and finished tasks are not filed: a parked one
+	is resumed by the neighbour that drops its fork.
+3. If memory runs out, the task would be lost: stops the simulation.
+*/
+static void	task_run(t_worker *w, int i)
+{
+	u_int64_t	wake;
+	t_run		run;
+	int			err;
+
+	wake = 0;
+	err = 0;
+	run = task_step(w->data, i, &wake);
+	if (run == RUN_READY)
+		err = queue_push(w, i);
+	else if (run == RUN_TIMER)
+		err = timer_push(w, wake, i);
+	if (err)
+	{
+		write(2, "philo: out of memory\n", 21);
+		push_keep_iter(w->data, 0);
+	}
+}
+
+/*
+worker_idle(): Sleeps until the worker's next timer or until it is kicked.
+
+Parameters: w - A pointer to the worker.
+
+Return value: None.
+
+How it works:
+1. Under the worker's mutex, checks again that its queue is empty and that
+	the simulation goes on.
+2. Marks itself idle and waits on its condition variable until the
+	earliest timer, or POOL_IDLE_US without timers, so a missed kick only
+	delays stealing. pool_resume() and pool_wake_all() signal it.
+*/
+void	worker_idle(t_worker *w)
+{
+	struct timespec	ts;
+	u_int64_t		wake;
+
+	pthread_mutex_lock(&w->mu);
+	if (w->q_len == 0 && pull_keep_iter(w->data))
+	{
+		wake = get_time() + POOL_IDLE_US;
+		if (w->n_timers > 0)
+			wake = w->timers[0].key;
+		clock_to_mono(wake, &ts);
+		w->idle = 1;
+		atomic_fetch_add(&w->data->pool.n_idle, 1);
+		pthread_cond_timedwait(&w->cv, &w->mu, &ts);
+		atomic_fetch_sub(&w->data->pool.n_idle, 1);
+		w->idle = 0;
+	}
+	pthread_mutex_unlock(&w->mu);
+}
+
+/*
+pool_resume(): Makes a parked task ready again, from the worker that
+				dropped the fork it was waiting for.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            i - The index of the philosopher.
+
+Return value: None.
+
+How it works:
+1. Queues the task on the calling worker, which will run it if nobody
+	steals it first.
+2. If some worker is idle, kicks one so it can steal the task.
+*/
+void	pool_resume(t_data *data, int i)
+{
+	t_worker	*w;
+	int			k;
+	int			kicked;
+
+	if (queue_push(g_worker, i))
+		push_keep_iter(data, 0);
+	k = -1;
+	kicked = 0;
+	while (!kicked && atomic_load(&data->pool.n_idle) > 0
+		&& ++k < data->conf.n_workers)
+	{
+		w = &data->pool.workers[k];
+		pthread_mutex_lock(&w->mu);
+		kicked = w->idle;
+		if (kicked)
+			pthread_cond_signal(&w->cv);
+		pthread_mutex_unlock(&w->mu);
+	}
+}
+
+/*
+pool_wake_all(): Wakes every idle worker, so they see the simulation stop.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: None.
+*/
+void	pool_wake_all(t_data *data)
+{
+	int	k;
+
+	k = -1;
+	while (++k < data->conf.n_workers)
+	{
+		pthread_mutex_lock(&data->pool.workers[k].mu);
+		pthread_cond_broadcast(&data->pool.workers[k].cv);
+		pthread_mutex_unlock(&data->pool.workers[k].mu);
+	}
+}
+
+/*
+worker_routine(): The main routine of a worker thread.
+
+Parameters: worker_p - A void pointer to the worker.
+			This is cast to a t_worker pointer within the function.
+
+Return value: NULL.
+
+How it works:
+1. Binds the thread to its worker and to its log ring.
+2. Until the simulation stops, queues its due timers, then runs a task of
+	its own run queue, else a task stolen from another worker, else sleeps.
+*/
+void	*worker_routine(void *worker_p)
+{
+	t_worker	*w;
+	int			i;
+
+	w = (t_worker *)worker_p;
+	g_worker = w;
+	log_attach(w->data, w->id);
+	while (pull_keep_iter(w->data))
+	{
+		if (timer_expire(w))
+			push_keep_iter(w->data, 0);
+		if (queue_pop(w, &i) || queue_steal_any(w->data, w, &i))
+			task_run(w, i);
+		else
+			worker_idle(w);
+	}
+	return (NULL);
+}
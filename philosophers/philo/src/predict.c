@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   predict.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:40:43 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 02:41:15 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+parse_predict(): Parses --predict and --predict-only.
+
+Parameters: arg - The command-line argument.
+            opts - A pointer to the options structure.
+
+Return value: 0.
+*/
+int	parse_predict(char *arg, t_opts *opts)
+{
+	opts->predict = PREDICT_REPORT;
+	if (opt_flag(arg, "predict-only"))
+		opts->predict = PREDICT_ONLY;
+	return (0);
+}
+
+/*
+predict(): Predicts the outcome of a run from its arguments alone.
+
+Parameters: p - Where to store the prediction.
+            arg - The five arguments of the run, the meal count being -1
+				when it is not given.
+
+Return value: None.
+
+How it works:
+1. Counts the phases of the table: the groups that eat one after the
+	other. A philosopher then starts a meal every phases * time to eat,
+	or every time to eat + time to sleep if its sleep is longer than its
+	wait for the forks: thinking only fills the gap, see think_time().
+2. The first group eats at 0, so if the period is longer than the time to
+	die, it dies at the time to die, unless the last group ends its last
+	required meal first. The last group starts its first meal
+	(phases - 1) * time to eat in, and every meal a period later.
+3. A single philosopher has one fork: it waits until it dies.
+*/
+void	predict(t_predict *p, int *arg)
+{
+	long	eat;
+	long	todie;
+
+	eat = arg[2] * 1000L;
+	todie = arg[1] * 1000L;
+	p->phases = 2 + arg[0] % 2;
+	p->period_us = p->phases * eat;
+	if (eat + arg[3] * 1000L > p->period_us)
+		p->period_us = eat + arg[3] * 1000L;
+	if (arg[0] == 1)
+		p->phases = 1;
+	if (arg[0] == 1)
+		p->period_us = todie;
+	p->margin_us = todie - p->period_us;
+	p->full_us = -1;
+	if (arg[4] > 0 && arg[0] > 1)
+		p->full_us = p->phases * eat + (arg[4] - 1) * p->period_us;
+	p->death_us = -1;
+	if (arg[0] == 1 || (p->margin_us < 0
+			&& (p->full_us < 0 || p->full_us > todie)))
+		p->death_us = todie;
+}
+
+/*
+predict_print(): Prints a prediction.
+
+Parameters: p - A pointer to the prediction.
+            arg - The five arguments of the run.
+            stream - Where to print it.
+
+Return value: None.
+*/
+void	predict_print(t_predict *p, int *arg, FILE *stream)
+{
+	if (arg[0] == 1)
+		fprintf(stream, "predict: a single fork, never eats");
+	else
+		fprintf(stream, "predict: %d phases, a meal every %ld ms, margin "
+			"%ld ms", p->phases, p->period_us / 1000, p->margin_us / 1000);
+	if (p->death_us >= 0)
+		fprintf(stream, ": dies at %ld ms\n", p->death_us / 1000);
+	else if (p->full_us >= 0)
+		fprintf(stream, ": survives, full at %ld ms\n", p->full_us / 1000);
+	else
+		fprintf(stream, ": survives\n");
+}
+
+/*
+predict_main(): Predicts the outcome of the run given on the command line.
+
+Parameters: ac - The count of command-line arguments.
+            av - The command-line arguments, checked by input_check().
+            opts - A pointer to the parsed options.
+
+Return value: 1 if the live run must be skipped, 0 otherwise.
+
+How it works:
+1. Predicts the outcome of the arguments.
+2. With --predict-only, prints it on stdout and skips the live run.
+	With --predict, prints it on stderr, away from the log, before the
+	live run.
+*/
+int	predict_main(int ac, char **av, t_opts *opts)
+{
+	t_predict	p;
+	int			arg[SWEEP_ARGS];
+	int			k;
+
+	arg[SWEEP_ARGS - 1] = -1;
+	k = 0;
+	while (++k < ac)
+		arg[k - 1] = ft_atoi(av[k]);
+	predict(&p, arg);
+	if (opts->predict == PREDICT_ONLY)
+		predict_print(&p, arg, stdout);
+	else
+		predict_print(&p, arg, stderr);
+	return (opts->predict == PREDICT_ONLY);
+}
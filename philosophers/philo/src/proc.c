@@ -0,0 +1,152 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   proc.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:12:44 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:36:41 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+proc_check(): Checks that the options can run with --processes.
+
+Parameters: opts - A pointer to the options parsed from the command line.
+
+Return value: 0 if they can, 1 otherwise, after printing why.
+
+How it works:
+1. Rejects the worker pool, the coroutines and the virtual clock, which
+	run the philosophers as tasks of a few threads, and --sweep, which
+	runs its simulations in threads of its own.
+2. Rejects the --forks strategies and --fork-lock locks other than the
+	defaults: their waits are private to a process.
+*/
+int	proc_check(t_opts *opts)
+{
+	if (opts->workers || opts->coroutines || opts->sweep
+		|| opts->clock == CLOCK_SRC_VIRTUAL)
+	{
+		write(2, "philo: --processes needs a thread per philosopher\n", 50);
+		return (1);
+	}
+	if (opts->forks != FORKS_ORDER || opts->fork_lock != LOCK_MUTEX)
+	{
+		write(2, "philo: --processes only runs the default --forks and "
+			"--fork-lock\n", 65);
+		return (1);
+	}
+	return (0);
+}
+
+/*
+proc_child(): Runs a philosopher in a forked child. Never returns.
+
+Parameters: philo - A pointer to the philosopher structure.
+            parent - The process id of the parent.
+
+Return value: None.
+
+How it works:
+1. Asks to be killed when the parent dies, so a philosopher never
+	outlives its supervisor, and exits at once if it did already.
+2. Runs the philosopher's routine, as its thread would.
+3. Exits with _exit, which skips the atexit handlers and stdio buffers
+	the child inherited from the parent.
+*/
+static void	proc_child(t_philo *philo, pid_t parent)
+{
+	prctl(PR_SET_PDEATHSIG, SIGKILL);
+	if (getppid() == parent)
+		routine(philo);
+	_exit(0);
+}
+
+/*
+proc_start(): Forks a child for each philosopher and starts the parent's
+				threads.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: 0 if the log writer and the completion monitor are started,
+				1 otherwise.
+
+How it works:
+1. Forks every philosopher before the parent starts any thread, so each
+	child is a copy of a single-threaded process.
+2. If a fork fails, stops the children already running, which then end
+	like they do after a death.
+3. Starts the log writer thread, which drains the children's rings in the
+	shared mapping, and the completion monitor if the number of meals is
+	specified. The death monitor runs in proc_join().
+*/
+int	proc_start(t_data *data)
+{
+	int		i;
+	pid_t	pid;
+	pid_t	parent;
+
+	i = -1;
+	parent = getpid();
+	while (++i < data->conf.n_philos)
+	{
+		pid = fork();
+		if (pid == 0)
+			proc_child(&data->philo[i], parent);
+		if (pid < 0)
+		{
+			write(2, "philo: cannot fork a philosopher\n", 33);
+			push_keep_iter(data, 0);
+			notify_all(data);
+			break ;
+		}
+	}
+	if (log_start(data))
+		return (1);
+	if (n_meal_trigger(data)
+		&& pthread_create(&data->monit_all_full, NULL, &all_full_routine, data))
+		return (1);
+	return (0);
+}
+
+/*
+proc_join(): Supervises the children until the simulation ends, then
+				reaps them.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+
+Return value: 0 if the simulation ends normally, 1 if the completion
+				monitor cannot be joined.
+
+How it works:
+1. Runs all_alive_routine on the parent's own thread: the parent is the
+	supervisor, and watches the children's deadlines in the shared
+	heap. It returns after a death, or once the completion monitor stops
+	the simulation.
+2. Joins the completion monitor, if any.
+3. Waits for every child to exit, then stops the log writer thread, so
+	it drains the children's last events.
+4. Prints the --stats table, from the counters the children left in the
+	shared mapping.
+*/
+int	proc_join(t_data *data)
+{
+	pid_t	pid;
+
+	all_alive_routine(data);
+	if (n_meal_trigger(data) && pthread_join(data->monit_all_full, NULL))
+		return (1);
+	pid = wait(NULL);
+	while (pid > 0)
+		pid = wait(NULL);
+	log_stop(data);
+	if (data->opts.stats)
+		stats_report(data);
+	return (0);
+}
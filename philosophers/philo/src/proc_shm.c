@@ -0,0 +1,163 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   proc_shm.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:12:44 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 04:20:44 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+static t_shm	g_shm;
+
+/*
+shm_alloc(): Carves a block out of the --processes shared mapping.
+
+Parameters: size - The size of the block.
+
+Return value: A pointer to the block, on a cache line boundary, or NULL if
+				the mapping is full.
+
+How it works:
+1. Rounds the size up to whole cache lines, so every block starts on a
+	cache line boundary, as aligned_alloc() would give.
+2. Hands out the next free bytes. The mapping is zero-filled and freed as
+	a whole by proc_unmap(), so blocks are never freed one by one.
+*/
+static void	*shm_alloc(size_t size)
+{
+	void	*block;
+
+	size = (size + CACHE_LINE - 1) & ~((size_t)CACHE_LINE - 1);
+	if (!g_shm.base || g_shm.off + size > g_shm.len)
+		return (NULL);
+	block = g_shm.base + g_shm.off;
+	g_shm.off += size;
+	return (block);
+}
+
+/*
+proc_map(): Maps the shared memory of a --processes simulation.
+
+Parameters: n_philos - The number of philosophers.
+
+Return value: A pointer to the data structure, at the start of the
+				mapping, or NULL if it cannot be mapped.
+
+How it works:
+1. Sizes the mapping for the data structure and, per philosopher and
+	for the monitor's log ring, every array data_malloc() allocates, with
+	a cache line of slack for each rounding of shm_alloc() and of the
+	padded layout.
+2. Maps it shared and anonymous before any fork(), so every child sees
+	the same pages at the same addresses, and the pointers in it stay
+	valid in all of them.
+3. Moves the sleep counters into it with sleep_share(), so the children's
+	sleeps are counted where the parent reports them.
+*/
+t_data	*proc_map(int n_philos)
+{
+	t_data	*data;
+	size_t	per_philo;
+
+	per_philo = sizeof(t_philo) + sizeof(t_philo_hot) + sizeof(t_fork)
+		+ sizeof(pthread_t) + sizeof(t_dl_node) + sizeof(int)
+		+ sizeof(t_ring) + LOG_RING_SIZE * sizeof(t_log_event)
+		+ 2 * CACHE_LINE;
+	g_shm.len = sizeof(t_data) + sizeof(t_sleep)
+		+ (n_philos + 1) * per_philo + 16 * CACHE_LINE;
+	g_shm.off = 0;
+	g_shm.base = mmap(NULL, g_shm.len, PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (g_shm.base == MAP_FAILED)
+	{
+		g_shm.base = NULL;
+		return (NULL);
+	}
+	data = shm_alloc(sizeof(t_data));
+	sleep_share(shm_alloc(sizeof(t_sleep)));
+	return (data);
+}
+
+/*
+proc_unmap(): Unmaps the shared memory of a --processes simulation.
+
+Return value: None.
+
+How it works:
+1. Moves the sleep counters back out of the mapping first.
+*/
+void	proc_unmap(void)
+{
+	if (g_shm.base)
+	{
+		sleep_share(NULL);
+		munmap(g_shm.base, g_shm.len);
+	}
+	g_shm.base = NULL;
+}
+
+/*
+data_alloc(): Allocates one of the arrays of the simulation.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            size - The size of the array.
+            align - 1 to put the array on a cache line boundary.
+
+Return value: A pointer to the array, or NULL if the allocation fails.
+
+How it works:
+1. With --processes, takes it from the shared mapping, where every block
+	is cache line aligned.
+2. Otherwise uses aligned_alloc() or malloc(), as asked.
+*/
+void	*data_alloc(t_data *data, size_t size, int align)
+{
+	if (data->opts.processes)
+		return (shm_alloc(size));
+	if (align)
+		return (aligned_alloc(CACHE_LINE, size));
+	return (malloc(size));
+}
+
+/*
+sync_init(): Initializes a mutex and a condition variable of the simulation.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            mu - A pointer to the mutex.
+            cv - A pointer to the condition variable, or NULL if none.
+
+Return value: None.
+
+How it works:
+1. With --processes, makes both process-shared, so the children and the
+	supervisor can lock and wait on them in the shared mapping.
+2. Times the condition variable's timed waits on CLOCK_MONOTONIC.
+*/
+void	sync_init(t_data *data, pthread_mutex_t *mu, pthread_cond_t *cv)
+{
+	pthread_mutexattr_t	mu_attr;
+	pthread_condattr_t	cv_attr;
+	int					pshared;
+
+	pshared = PTHREAD_PROCESS_PRIVATE;
+	if (data->opts.processes)
+		pshared = PTHREAD_PROCESS_SHARED;
+	pthread_mutexattr_init(&mu_attr);
+	pthread_mutexattr_setpshared(&mu_attr, pshared);
+	pthread_mutex_init(mu, &mu_attr);
+	pthread_mutexattr_destroy(&mu_attr);
+	if (!cv)
+		return ;
+	pthread_condattr_init(&cv_attr);
+	pthread_condattr_setpshared(&cv_attr, pshared);
+	pthread_condattr_setclock(&cv_attr, CLOCK_MONOTONIC);
+	pthread_cond_init(cv, &cv_attr);
+	pthread_condattr_destroy(&cv_attr);
+}
@@ -6,83 +6,62 @@
 /*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2023/12/04 20:24:32 by pmelis            #+#    #+#             */
-/*   Updated: 2023/12/12 20:09:25 by pmelis           ###   ########.fr       */
+/*   Updated: 2026/10/18 01:48:13 by pmelis           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../include/philo.h"
 
 /*
-pull_death_time(): Returns the time in milliseconds a philosopher when a
+pull_death_time(): Returns the time in microseconds after which a
 					philosopher will die if he doesn't eat.
 
 Parameters: data - A pointer to the data structure that holds
 					the simulation data.
 
-Return value: The time in milliseconds a philosopher will die if he doesn't eat.
+Return value: The time in microseconds a philosopher will die if he doesn't eat.
 
 How it works:
-1. Locks the mutex associated with the time to die data.
-2. Reads the time to die data.
-3. Unlocks the mutex.
-4. Returns the time to die data.
+1. Reads the value from the config block. It never changes once the threads
+	are running, so no lock is needed.
 */
 u_int64_t	pull_death_time(t_data *data)
 {
-	u_int64_t	ms_todie;
-
-	pthread_mutex_lock(&data->ms_todie_mu);
-	ms_todie = data->ms_todie;
-	pthread_mutex_unlock(&data->ms_todie_mu);
-	return (ms_todie);
+	return (data->conf.us_todie);
 }
 
 /*
-pull_sleep_time(): Returns the time in milliseconds a philosopher will sleep.
+pull_sleep_time(): Returns the time in microseconds a philosopher will sleep.
 
 Parameters: data - A pointer to the data structure that holds
 					the simulation data.
 
-Return value: The time in milliseconds a philosopher will sleep.
+Return value: The time in microseconds a philosopher will sleep.
 
 How it works:
-1. Locks the mutex associated with the time to sleep data.
-2. Reads the time to sleep data.
-3. Unlocks the mutex.
-4. Returns the time to sleep data.
+1. Reads the value from the config block. It never changes once the threads
+	are running, so no lock is needed.
 */
 u_int64_t	pull_sleep_time(t_data *data)
 {
-	u_int64_t	ms_tosleep;
-
-	pthread_mutex_lock(&data->ms_tosleep_mu);
-	ms_tosleep = data->ms_tosleep;
-	pthread_mutex_unlock(&data->ms_tosleep_mu);
-	return (ms_tosleep);
+	return (data->conf.us_tosleep);
 }
 
 /*
-pull_eat_time(): Returns the time in milliseconds a philosopher will eat.
+pull_eat_time(): Returns the time in microseconds a philosopher will eat.
 
 Parameters: data - A pointer to the data structure that holds
 				the simulation data.
 
-Return value: The time in milliseconds a philosopher will eat.
+Return value: The time in microseconds a philosopher will eat.
 
 How it works:
-1. Locks the mutex associated with the time to eat data.
-2. Reads the time to eat data.
-3. Unlocks the mutex.
-4. Returns the time to eat data.
+1. Reads the value from the config block. It never changes once the threads
+	are running, so no lock is needed.
 */
 u_int64_t	pull_eat_time(t_data *data)
 {
-	u_int64_t	ms_toeat;
-
-	pthread_mutex_lock(&data->ms_toeat_mu);
-	ms_toeat = data->ms_toeat;
-	pthread_mutex_unlock(&data->ms_toeat_mu);
-	return (ms_toeat);
+	return (data->conf.us_toeat);
 }
 
 /*
@@ -93,19 +72,15 @@ Parameters: philo - A pointer to the philosopher structure.
 Return value: The time of the last meal of the philosopher.
 
 How it works:
-1. Locks the mutex associated with the last meal data of the philosopher.
-2. Reads the last meal data of the philosopher.
-3. Unlocks the mutex.
-4. Returns the last meal data.
+1. Atomically loads the meal word of the philosopher.
+2. Returns the last meal time stored in its low bits.
 */
 u_int64_t	pull_last_meal(t_philo *philo)
 {
-	u_int64_t	last_meal;
+	u_int64_t	word;
 
-	pthread_mutex_lock(&philo->last_meal_mu);
-	last_meal = philo->last_meal;
-	pthread_mutex_unlock(&philo->last_meal_mu);
-	return (last_meal);
+	word = atomic_load_explicit(&philo->hot->meal_word, memory_order_acquire);
+	return (word & MEAL_MASK);
 }
 
 /*
@@ -114,20 +89,13 @@ pull_start_time(): Returns the start time of the simulation.
 Parameters: data - A pointer to the data structure that holds
 			the simulation data.
 
-Return value: The start time of the simulation.
+Return value: The start time of the simulation, in microseconds.
 
 How it works:
-1. Locks the mutex associated with the start time data.
-2. Reads the start time data.
-3. Unlocks the mutex.
-4. Returns the start time data.
+1. Reads the value from the config block. It never changes once the threads
+	are running, so no lock is needed.
 */
 u_int64_t	pull_start_time(t_data *data)
 {
-	u_int64_t	time;
-
-	pthread_mutex_lock(&data->start_time_mu);
-	time = data->start_time;
-	pthread_mutex_unlock(&data->start_time_mu);
-	return (time);
+	return (data->conf.start_time);
 }
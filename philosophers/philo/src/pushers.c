@@ -6,7 +6,7 @@
 /*   By: pmelis <pmelis@student.42wolfsburg.de>     +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2023/12/05 14:49:09 by pmelis            #+#    #+#             */
-/*   Updated: 2023/12/09 19:45:28 by pmelis           ###   ########.fr       */
+/*   Updated: 2026/10/18 02:52:00 by pmelis           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -21,16 +21,24 @@ Parameters: philo - A pointer to the philosopher structure.
 Return value: None.
 
 How it works:
-1. Locks the mutex associated with the state data of the philosopher.
-2. If the philosopher is not dead, sets the state data of the philosopher.
-3. Unlocks the mutex.
+1. Loads the philosopher's meal word.
+2. If the philosopher is already dead, leaves the word untouched.
+3. Otherwise, swaps in the new state while keeping the last meal time,
+	retrying if another thread changed the word in the meantime.
 */
 void	push_philo_state(t_philo *philo, t_state state)
 {
-	pthread_mutex_lock(&philo->state_mu);
-	if (philo->state != DEAD)
-		philo->state = state;
-	pthread_mutex_unlock(&philo->state_mu);
+	u_int64_t	old;
+	u_int64_t	new;
+
+	old = atomic_load_explicit(&philo->hot->meal_word, memory_order_acquire);
+	while ((old >> STATE_SHIFT) != DEAD)
+	{
+		new = pack_meal_word(old & MEAL_MASK, state);
+		if (atomic_compare_exchange_weak_explicit(&philo->hot->meal_word,
+				&old, new, memory_order_acq_rel, memory_order_acquire))
+			break ;
+	}
 }
 
 /*
@@ -43,13 +51,40 @@ Parameters: data - A pointer to the data structure that holds
 Return value: None.
 
 How it works:
-1. Locks the mutex associated with the keep_iter data.
-2. Sets the keep_iter data.
-3. Unlocks the mutex.
+1. Atomically stores the new value of the keep_iter flag.
+2. Wakes the death monitor, which may be waiting for a deadline, and the
+	completion monitor, which may be waiting for the last meal. The store
+	is made under both mutexes so neither wake-up can be lost.
+3. Wakes the idle pool workers, if any, which check the flag under their
+	own mutex, and the philosophers waiting in a --forks strategy.
 */
 void	push_keep_iter(t_data *data, int set_to)
 {
-	pthread_mutex_lock(&data->keep_iter_mu);
-	data->keep_iter = set_to;
-	pthread_mutex_unlock(&data->keep_iter_mu);
+	pthread_mutex_lock(&data->dl.mu);
+	pthread_mutex_lock(&data->full.mu);
+	atomic_store_explicit(&data->keep_iter, set_to, memory_order_release);
+	pthread_cond_broadcast(&data->dl.cv);
+	pthread_cond_broadcast(&data->full.cv);
+	pthread_mutex_unlock(&data->full.mu);
+	pthread_mutex_unlock(&data->dl.mu);
+	if (data->conf.n_workers)
+		pool_wake_all(data);
+	strategy_wake(data);
+}
+
+/*
+pack_meal_word(): Packs a last meal time and a state into one meal word.
+
+Parameters: last_meal - The time of the philosopher's last meal.
+            state - The state of the philosopher.
+
+Return value: The packed meal word.
+
+How it works:
+1. Keeps the low 60 bits of the last meal time.
+2. Stores the state in the top 4 bits.
+*/
+u_int64_t	pack_meal_word(u_int64_t last_meal, t_state state)
+{
+	return ((last_meal & MEAL_MASK) | ((u_int64_t)state << STATE_SHIFT));
 }
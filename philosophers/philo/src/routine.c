@@ -6,7 +6,7 @@
 /*   By: pmelis <pmelis@student.42wolfsburg.de>     +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2023/12/05 15:43:28 by pmelis            #+#    #+#             */
-/*   Updated: 2023/12/09 20:33:12 by pmelis           ###   ########.fr       */
+/*   Updated: 2026/10/18 04:22:21 by pmelis           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -21,7 +21,9 @@ Parameters: philo_p - A void pointer to the philosopher structure.
 Return value: NULL.
 
 How it works:
-1. Updates the philosopher's last meal time.
+1. Binds the thread to the philosopher's log ring, unless it runs as a
+	coroutine on the scheduler's thread, and updates the philosopher's
+	last meal time.
 2. If the philosopher's ID is even, the philosopher sleeps for a short
 	duration to avoid deadlock.
 3. Enters a loop that continues until the philosopher's state is DEAD.
@@ -39,9 +41,11 @@ void	*routine(void *philo_p)
 	t_philo	*philo;
 
 	philo = (t_philo *)philo_p;
+	if (!philo->data->opts.coroutines)
+		log_attach(philo->data, philo->id - 1);
 	update_last_meal(philo);
 	if (philo->id % 2 == 0)
-		ft_usleep(philo->data->ms_toeat - 10);
+		ft_usleep(philo->data->conf.us_toeat - 10000);
 	while (pull_philo_state(philo) != DEAD)
 	{
 		if (eat(philo))
@@ -68,32 +72,17 @@ Parameters: data_p - A void pointer to the data structure.
 Return value: NULL.
 
 How it works:
-1. Retrieves the number of philosophers.
-2. Enters a loop that continues until all philosophers have eaten the
-	required number of meals.
-3. In each iteration of the loop:
-	- Sleeps for 1 millisecond.
-	- Checks if the current philosopher has eaten the required number of meals.
-		If not, resets the index to -1.
-4. If all philosophers have eaten the required number of meals,
+1. Sleeps in full_wait until the last philosopher finishes its last
+	required meal, or until the simulation stops for another reason.
+2. If all philosophers have eaten the required number of meals,
 	sets the keep_iter flag to 0 and notifies all philosophers.
 */
 void	*all_full_routine(void *data_p)
 {
 	t_data	*data;
-	int		i;
-	int		n_philo;
 
 	data = (t_data *)data_p;
-	i = -1;
-	n_philo = pull_n_philos(data);
-	while (++i < n_philo && pull_keep_iter(data))
-	{
-		usleep(1000);
-		if (!is_full(data, &data->philo[i]))
-			i = -1;
-	}
-	if (pull_keep_iter(data))
+	if (full_wait(data) && pull_keep_iter(data))
 	{
 		push_keep_iter(data, 0);
 		notify_all(data);
@@ -110,39 +99,37 @@ Parameters: data_p - A void pointer to the data structure.
 Return value: NULL.
 
 How it works:
-1. Retrieves the number of philosophers.
-2. Enters a loop that continues until a philosopher dies
-	or all philosophers have stopped eating.
-3. In each iteration of the loop:
-	- Checks if the current philosopher is dead. If so, prints a message,
-	stops all philosophers from eating, notifies all philosophers,
-	and breaks the loop.
-	- If the end of the philosopher array is reached, resets the index to -1.
-	- Sleeps for 1 millisecond.
+0. Binds the thread to the last log ring, after the philosophers' ones.
+1. Waits with dl_next_due until the earliest death deadline has passed,
+	sleeping in between, so detection latency does not grow with the
+	number of philosophers.
+2. If that philosopher is dead, prints a message, stops all philosophers
+	from eating, notifies all philosophers, and returns. The log writer
+	records how late the message was written.
+3. Otherwise, it ate or is eating: records a near-miss with death_note
+	if it was found past its deadline, and reschedules it with dl_postpone.
+4. Returns when dl_next_due reports that the simulation is stopping.
 */
 void	*all_alive_routine(void *data_p)
 {
 	int		i;
-	int		n_philos;
 	t_data	*data;
-	t_philo	*philo;
 
-	i = -1;
 	data = (t_data *)data_p;
-	philo = data->philo;
-	n_philos = pull_n_philos(data);
-	while (++i < n_philos && pull_keep_iter(data))
+	log_attach(data, data->log.n_rings - 1);
+	i = dl_next_due(data);
+	while (i >= 0)
 	{
-		if (philo_death(&philo[i]) && pull_keep_iter(data))
+		if (philo_death(&data->philo[i]) && pull_keep_iter(data))
 		{
-			print_changestate(data, philo[i].id, "died");
+			print_changestate(data, data->philo[i].id, MSG_DIED);
 			push_keep_iter(data, 0);
 			notify_all(data);
 			break ;
 		}
-		if (i == n_philos - 1)
-			i = -1;
-		usleep(1000);
+		death_note(data, i, 0);
+		dl_postpone(data, i);
+		i = dl_next_due(data);
 	}
 	return (NULL);
 }
@@ -0,0 +1,165 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sleep.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:48:40 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 04:20:44 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+g_sleep: the sleep tuning and overshoot counters. The slack is written once
+by sleep_init() before any thread is created; the counters are only
+touched when --sleep-report is given. They live in g_own, or with
+--processes in the shared mapping, see sleep_share().
+*/
+static t_sleep	g_own;
+static t_sleep	*g_sleep = &g_own;
+
+/*
+sleep_calibrate(): Measures how late clock_nanosleep wakes up on this host.
+
+Parameters: None.
+
+Return value: The slack to leave before a deadline, in nanoseconds.
+
+How it works:
+1. Sleeps SLEEP_CALIB_RUNS times for 1 ms to an absolute deadline and keeps
+	the worst wake-up delay.
+2. Returns one and a half times that delay, clamped to
+	[SLEEP_SLACK_MIN_NS, SLEEP_SLACK_MAX_NS].
+*/
+static u_int64_t	sleep_calibrate(void)
+{
+	struct timespec	ts;
+	u_int64_t		target;
+	u_int64_t		worst;
+	int				i;
+
+	worst = 0;
+	i = -1;
+	while (++i < SLEEP_CALIB_RUNS)
+	{
+		target = mono_ns() + 1000000;
+		ts.tv_sec = target / 1000000000;
+		ts.tv_nsec = target % 1000000000;
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+		if (mono_ns() - target > worst)
+			worst = mono_ns() - target;
+	}
+	worst += worst / 2;
+	if (worst < SLEEP_SLACK_MIN_NS)
+		worst = SLEEP_SLACK_MIN_NS;
+	if (worst > SLEEP_SLACK_MAX_NS)
+		worst = SLEEP_SLACK_MAX_NS;
+	return (worst);
+}
+
+/*
+sleep_init(): Sets the slack of ft_usleep().
+
+Parameters: slack_us - The slack in microseconds, or 0 to calibrate it.
+            report - 1 to count the overshoot of every sleep.
+
+Return value: None.
+*/
+void	sleep_init(u_int64_t slack_us, int report)
+{
+	g_sleep->slack_ns = slack_us * 1000;
+	if (slack_us == 0)
+		g_sleep->slack_ns = sleep_calibrate();
+	g_sleep->report = report;
+	atomic_init(&g_sleep->n_sleeps, 0);
+	atomic_init(&g_sleep->total_ns, 0);
+	atomic_init(&g_sleep->max_ns, 0);
+}
+
+/*
+ft_usleep(): Pauses the execution of the program for a specified amount of time.
+
+Parameters: sleep_time - The amount of time to sleep in microseconds.
+
+Return value: How late the call returned, in microseconds.
+
+How it works:
+0. In a coroutine, yields to the scheduler with co_sleep instead, which
+	does not block the thread the other coroutines run on.
+1. Computes the deadline on the selected clock.
+2. Blocks in clock_nanosleep until the deadline minus the slack. The
+	target is converted to CLOCK_MONOTONIC from the time left, so it
+	stays right whichever clock source is selected.
+3. Yields the CPU until the deadline has passed, which absorbs the
+	kernel's wake-up delay without a long busy loop.
+4. Records the overshoot if --sleep-report was given and returns it.
+*/
+u_int64_t	ft_usleep(u_int64_t sleep_time)
+{
+	struct timespec	ts;
+	u_int64_t		deadline;
+	u_int64_t		target;
+	u_int64_t		now;
+
+	if (co_current())
+		return (co_sleep(sleep_time));
+	deadline = clock_ns() + sleep_time * 1000;
+	if (sleep_time * 1000 > g_sleep->slack_ns)
+	{
+		target = mono_ns() + sleep_time * 1000 - g_sleep->slack_ns;
+		ts.tv_sec = target / 1000000000;
+		ts.tv_nsec = target % 1000000000;
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+	}
+	now = clock_ns();
+	while (now < deadline)
+	{
+		sched_yield();
+		now = clock_ns();
+	}
+	if (g_sleep->report)
+		sleep_record(g_sleep, now - deadline);
+	return ((now - deadline) / 1000);
+}
+
+/*
+sleep_report(): Prints the overshoot of every ft_usleep() since sleep_init()
+				on stderr, if --sleep-report was given.
+
+Parameters: None.
+
+Return value: None.
+*/
+void	sleep_report(void)
+{
+	if (g_sleep->report)
+		sleep_print(g_sleep);
+}
+
+/*
+sleep_share(): Moves the sleep counters in or out of shared memory.
+
+Parameters: shared - A pointer to the counters in the --processes shared
+				mapping, or NULL to move them back before it is unmapped.
+
+Return value: None.
+
+How it works:
+1. Copies the slack and the counters over, and points g_sleep at the
+	copy, so the sleeps of every forked child add up where the parent's
+	sleep_report() reads them.
+*/
+void	sleep_share(t_sleep *shared)
+{
+	if (!shared)
+	{
+		memcpy(&g_own, g_sleep, sizeof(t_sleep));
+		g_sleep = &g_own;
+		return ;
+	}
+	memcpy(shared, g_sleep, sizeof(t_sleep));
+	g_sleep = shared;
+}
@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sleep_report.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:48:40 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 01:48:40 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+sleep_record(): Adds one overshoot to the sleep counters.
+
+Parameters: sleep - A pointer to the sleep counters.
+            over_ns - How late the sleep returned, in nanoseconds.
+
+Return value: None.
+
+How it works:
+1. Atomically counts the sleep and adds its overshoot.
+2. Raises the maximum with a CAS loop if this overshoot is larger.
+*/
+void	sleep_record(t_sleep *sleep, u_int64_t over_ns)
+{
+	u_int64_t	max;
+
+	atomic_fetch_add_explicit(&sleep->n_sleeps, 1, memory_order_relaxed);
+	atomic_fetch_add_explicit(&sleep->total_ns, over_ns, memory_order_relaxed);
+	max = atomic_load_explicit(&sleep->max_ns, memory_order_relaxed);
+	while (over_ns > max)
+	{
+		if (atomic_compare_exchange_weak_explicit(&sleep->max_ns, &max,
+				over_ns, memory_order_relaxed, memory_order_relaxed))
+			break ;
+	}
+}
+
+/*
+sleep_print(): Prints the sleep counters on stderr.
+
+Parameters: sleep - A pointer to the sleep counters.
+
+Return value: None.
+*/
+void	sleep_print(t_sleep *sleep)
+{
+	u_int64_t	n;
+
+	n = atomic_load(&sleep->n_sleeps);
+	if (n == 0)
+		n = 1;
+	fprintf(stderr, "sleep: slack %llu us, %llu sleeps, overshoot avg %llu us"
+		", max %llu us\n", (unsigned long long)sleep->slack_ns / 1000,
+		(unsigned long long)atomic_load(&sleep->n_sleeps),
+		(unsigned long long)atomic_load(&sleep->total_ns) / n / 1000,
+		(unsigned long long)atomic_load(&sleep->max_ns) / 1000);
+}
@@ -0,0 +1,174 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:31:51 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 04:24:17 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+stats_init(): Empties the --stats counters of a philosopher.
+
+Parameters: hot - A pointer to the hot part of the philosopher.
+
+Return value: None.
+
+How it works:
+1. Zeroes every span, with a shortest time above any real one, so that
+	the first sample sets it.
+2. Starts the least slack above any real one too.
+*/
+void	stats_init(t_philo_hot *hot)
+{
+	int	i;
+
+	i = -1;
+	while (++i < STAT_N)
+	{
+		memset(&hot->stats[i], 0, sizeof(t_span));
+		hot->stats[i].min = UINT64_MAX;
+	}
+	hot->slack_min_us = INT64_MAX;
+}
+
+/*
+stats_span(): Adds one duration to a span.
+
+Parameters: span - A pointer to the span, which only the calling
+				philosopher writes.
+            us - The duration, in microseconds.
+
+Return value: None.
+
+How it works:
+1. Counts it, adds it to the sum, and keeps the shortest and the longest.
+	Plain stores: nobody reads the span before the philosophers joined.
+*/
+void	stats_span(t_span *span, u_int64_t us)
+{
+	span->n++;
+	span->sum += us;
+	if (us < span->min)
+		span->min = us;
+	if (us > span->max)
+		span->max = us;
+}
+
+/*
+span_print(): Prints the shortest, average and longest time of a span,
+				and adds it to the totals.
+
+Parameters: span - A pointer to the span.
+            into - A pointer to the span of the totals, or NULL.
+
+Return value: None.
+
+How it works:
+1. Prints three dashes if the span is empty.
+2. Otherwise prints the three times in milliseconds, on stderr.
+3. Adds its count and sum to the totals, and keeps the shortest and the
+	longest time.
+*/
+static void	span_print(t_span *span, t_span *into)
+{
+	if (!span->n)
+	{
+		fprintf(stderr, " %8s %8s %8s ", "-", "-", "-");
+		return ;
+	}
+	fprintf(stderr, " %8.3f %8.3f %8.3f ", span->min / 1000.0,
+		(double)span->sum / span->n / 1000.0, span->max / 1000.0);
+	if (!into)
+		return ;
+	into->n += span->n;
+	into->sum += span->sum;
+	if (span->min < into->min)
+		into->min = span->min;
+	if (span->max > into->max)
+		into->max = span->max;
+}
+
+/*
+stats_row(): Prints the --stats row of a philosopher and adds its counters
+				to the totals.
+
+Parameters: id - The id of the philosopher, or 0 for the totals.
+            hot - A pointer to the hot part of the philosopher, where its
+				counters are, or to the totals.
+            all - A pointer to the totals, or NULL when printing them.
+
+Return value: None.
+
+How it works:
+1. Prints the id, or "all", and the meals, which are the eaten spans.
+2. Prints every span with span_print(), which adds it to the totals.
+3. Prints the least slack, a dash if it never ate, and keeps the least
+	one in the totals.
+*/
+static void	stats_row(int id, t_philo_hot *hot, t_philo_hot *all)
+{
+	int	i;
+
+	if (id)
+		fprintf(stderr, "stats: %5d %6llu", id,
+			(unsigned long long)hot->stats[STAT_EAT].n);
+	else
+		fprintf(stderr, "stats: %5s %6llu", "all",
+			(unsigned long long)hot->stats[STAT_EAT].n);
+	i = -1;
+	while (++i < STAT_N)
+	{
+		if (all)
+			span_print(&hot->stats[i], &all->stats[i]);
+		else
+			span_print(&hot->stats[i], NULL);
+	}
+	if (all && hot->slack_min_us < all->slack_min_us)
+		all->slack_min_us = hot->slack_min_us;
+	if (hot->slack_min_us == INT64_MAX)
+		fprintf(stderr, "%9s\n", "-");
+	else
+		fprintf(stderr, "%9.3f\n", hot->slack_min_us / 1000.0);
+}
+
+/*
+stats_report(): Prints the --stats table on stderr.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data, after the philosophers have joined.
+
+Return value: None.
+
+How it works:
+0. Prints nothing for the runs of a --sweep, which would interleave.
+1. Prints the requested meal and sleep times and the column names.
+2. Prints one row per philosopher with stats_row(), which adds it to the
+	totals, then the totals: every counter was written by one philosopher
+	only, so they are only summed here, once everyone has joined.
+*/
+void	stats_report(t_data *data)
+{
+	t_philo_hot	all;
+	int			i;
+
+	if (data->opts.sweep)
+		return ;
+	memset(&all, 0, sizeof(t_philo_hot));
+	stats_init(&all);
+	fprintf(stderr, "stats: times in ms; eat %.3f and sleep %.3f requested;"
+		" slack: least time left to the deadline when starting a meal\n",
+		pull_eat_time(data) / 1000.0, pull_sleep_time(data) / 1000.0);
+	fprintf(stderr, "stats: %5s %6s %8s %8s %8s  %8s %8s %8s  %8s %8s %8s "
+		"%9s\n", "id", "meals", "wait min", "avg", "max", "eat min", "avg",
+		"max", "slp min", "avg", "max", "slack");
+	i = -1;
+	while (++i < data->conf.n_philos)
+		stats_row(data->philo[i].id, data->philo[i].hot, &all);
+	stats_row(0, &all, NULL);
+}
@@ -0,0 +1,161 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sweep.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:33:17 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:41:54 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+parse_sweep(): Parses --sweep and --sweep=csv|json.
+
+Parameters: arg - The command-line argument.
+            opts - A pointer to the options structure.
+
+Return value: 0 if the format is csv or json, 1 otherwise.
+*/
+int	parse_sweep(char *arg, t_opts *opts)
+{
+	opts->sweep = SWEEP_CSV;
+	if (opt_flag(arg, "sweep") || !strcmp(opt_value(arg, "sweep"), "csv"))
+		return (0);
+	opts->sweep = SWEEP_JSON;
+	return (strcmp(opt_value(arg, "sweep"), "json") != 0);
+}
+
+/*
+sweep_range(): Parses one range lo[:hi[:step]] of a sweep.
+
+Parameters: arg - The positional argument, cut in place at the colons.
+            min - The smallest accepted value.
+            max - The largest accepted value.
+            r - Where to store the range.
+
+Return value: 0 if the range is valid, 1 otherwise.
+
+How it works:
+1. Splits the argument at its colons; hi defaults to lo and step to 1.
+2. Checks lo and hi against the bounds input_check() applies to a single
+	run: every value in between is then valid too.
+3. Counts the values of the range.
+*/
+static int	sweep_range(char *arg, u_int64_t min, u_int64_t max, t_range *r)
+{
+	char		*sep[2];
+	u_int64_t	hi;
+
+	sep[0] = strchr(arg, ':');
+	sep[1] = NULL;
+	if (sep[0])
+	{
+		*sep[0]++ = '\0';
+		sep[1] = strchr(sep[0], ':');
+	}
+	if (sep[1])
+		*sep[1]++ = '\0';
+	r->step = 1;
+	if (parse_uint(arg, max, &r->lo) || r->lo < min)
+		return (1);
+	hi = r->lo;
+	if ((sep[0] && parse_uint(sep[0], max, &hi))
+		|| (sep[1] && parse_uint(sep[1], max, &r->step)))
+		return (1);
+	if (hi < r->lo || r->step == 0)
+		return (1);
+	r->n = (hi - r->lo) / r->step + 1;
+	return (0);
+}
+
+/*
+sweep_parse(): Parses the ranges of a sweep.
+
+Parameters: sw - A pointer to the sweep.
+            ac - The count of positional arguments.
+            av - The positional arguments.
+            opts - A pointer to the parsed options.
+
+Return value: 0 if every range is valid, 1 otherwise.
+
+How it works:
+1. Takes 4 or 5 ranges, in the order of a single run's arguments. Without
+	a meal count, every run stops after SWEEP_MEALS meals, so that
+	surviving runs end too.
+2. Counts the runs, the product of the sizes of the ranges, and refuses
+	more than SWEEP_MAX_RUNS.
+*/
+static int	sweep_parse(t_sweep *sw, int ac, char **av, t_opts *opts)
+{
+	static const u_int64_t	min[SWEEP_ARGS] = {1, 60, 60, 60, 1};
+	u_int64_t				max;
+	u_int64_t				n;
+	int						k;
+
+	if (ac != 5 && ac != 6)
+		return (1);
+	sw->range[SWEEP_ARGS - 1].lo = SWEEP_MEALS;
+	sw->range[SWEEP_ARGS - 1].step = 1;
+	sw->range[SWEEP_ARGS - 1].n = 1;
+	n = 1;
+	k = -1;
+	while (++k < ac - 1)
+	{
+		max = 2147483647;
+		if (k == 0)
+			max = max_philos(opts);
+		if (sweep_range(av[k + 1], min[k], max, &sw->range[k]))
+			return (1);
+		n *= sw->range[k].n;
+		if (n > SWEEP_MAX_RUNS)
+			return (1);
+	}
+	sw->n_runs = (int)n;
+	return (0);
+}
+
+/*
+sweep_main(): Runs every configuration of a sweep and prints the results.
+
+Parameters: ac - The count of positional arguments.
+            av - The positional arguments, ranges instead of values.
+            opts - A pointer to the parsed options.
+
+Return value: 0 on success, 1 if a range is invalid, 2 if the sweep
+				cannot run.
+
+How it works:
+1. Parses the ranges; prints the usage if one is invalid.
+2. Gives every run the same options, without a trace file or a metrics
+	page, which the runs would share.
+3. Runs them with sweep_start and prints one row per run, in order,
+	then the --death-report over all the runs.
+*/
+int	sweep_main(int ac, char **av, t_opts *opts)
+{
+	t_sweep	sw;
+	int		err;
+
+	memset(&sw, 0, sizeof(t_sweep));
+	if (sweep_parse(&sw, ac, av, opts))
+	{
+		print_error();
+		return (1);
+	}
+	sw.opts = *opts;
+	sw.opts.trace = NULL;
+	sw.opts.metrics = NULL;
+	sw.runs = calloc(sw.n_runs, sizeof(t_sweep_run));
+	if (!sw.runs)
+		return (2);
+	err = sweep_start(&sw);
+	if (!err)
+		sweep_print(&sw);
+	death_report();
+	free(sw.runs);
+	return (2 * err);
+}
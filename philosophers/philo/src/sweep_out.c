@@ -0,0 +1,171 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sweep_out.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:33:17 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 02:41:15 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+outcome_gap(): Accounts for the wait of a philosopher for a meal.
+
+Parameters: o - A pointer to the outcome.
+            gap - The wait, in microseconds.
+            period - 1 if the wait started at a meal and ended at one.
+
+Return value: None.
+*/
+static void	outcome_gap(t_outcome *o, u_int64_t gap, int period)
+{
+	if (gap > o->hunger)
+		o->hunger = gap;
+	if (period && gap < o->period_min)
+		o->period_min = gap;
+	if (period && gap > o->period_max)
+		o->period_max = gap;
+}
+
+/*
+outcome_record(): Records an event of a --sweep run in its outcome.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            ev - The event, in timestamp order.
+
+Return value: None.
+
+How it works:
+1. Only meals and deaths count. Measures the time since the
+	philosopher's last meal, or since the start, and hands it to
+	outcome_gap: between two meals, it is also a period.
+3. Counts the meal, or records the death, after which the writer drops
+	every event, as it does in a normal run.
+*/
+void	outcome_record(t_data *data, t_log_event *ev)
+{
+	t_outcome	*o;
+	u_int64_t	*last;
+	u_int64_t	now;
+	u_int64_t	gap;
+
+	o = data->opts.outcome;
+	if (ev->msg != MSG_EAT && ev->msg != MSG_DIED)
+		return ;
+	last = &o->last[ev->id - 1];
+	now = ev->ts - pull_start_time(data);
+	gap = now;
+	if (*last)
+		gap = now - (*last - 1);
+	outcome_gap(o, gap, ev->msg == MSG_EAT && *last);
+	*last = now + 1;
+	o->meals += (ev->msg == MSG_EAT);
+	if (ev->msg != MSG_DIED)
+		return ;
+	o->died = 1;
+	o->death_us = now;
+	data->log.died = 1;
+}
+
+/*
+sweep_outcome(): Names the outcome of a run.
+
+Parameters: run - A pointer to the run.
+
+Return value: "error" if the run could not be set up, "died" if someone
+				died, "full" if everyone ate every meal, and
+				"predicted_died" or "predicted_full" for a run that was
+				only predicted.
+*/
+static char	*sweep_outcome(t_sweep_run *run)
+{
+	if (run->err)
+		return ("error");
+	if (run->predicted && run->out.died)
+		return ("predicted_died");
+	if (run->predicted)
+		return ("predicted_full");
+	if (run->out.died)
+		return ("died");
+	return ("full");
+}
+
+/*
+sweep_row(): Prints the row of one run.
+
+Parameters: run - A pointer to the run.
+            fmt - SWEEP_CSV or SWEEP_JSON.
+            sep - What follows a JSON object: "," or "".
+
+Return value: None.
+
+How it works:
+1. Prints the arguments and the outcome, then the time of the death, or
+	-1, the meals served, the longest wait for a meal, the margin left
+	before the time to die (negative on a death), and the jitter: the
+	spread between the shortest and longest time between two meals.
+*/
+static void	sweep_row(t_sweep_run *run, t_sweep_fmt fmt, char *sep)
+{
+	t_outcome	*o;
+	double		death;
+	double		jitter;
+
+	o = &run->out;
+	death = -1;
+	if (o->died)
+		death = o->death_us / 1000.0;
+	jitter = 0;
+	if (o->period_max >= o->period_min)
+		jitter = (o->period_max - o->period_min) / 1000.0;
+	if (fmt == SWEEP_CSV)
+		printf("%d,%d,%d,%d,%d,%s,%.3f,%llu,%.3f,%.3f,%.3f\n", run->arg[0],
+			run->arg[1], run->arg[2], run->arg[3], run->arg[4],
+			sweep_outcome(run), death, (unsigned long long)o->meals,
+			o->hunger / 1000.0, run->arg[1] - o->hunger / 1000.0, jitter);
+	else
+		printf("  {\"n_philos\": %d, \"ms_todie\": %d, \"ms_toeat\": %d, "
+			"\"ms_tosleep\": %d, \"n_meals\": %d, \"outcome\": \"%s\", "
+			"\"death_ms\": %.3f, \"meals\": %llu, \"max_hunger_ms\": %.3f, "
+			"\"margin_ms\": %.3f, \"jitter_ms\": %.3f}%s\n", run->arg[0],
+			run->arg[1], run->arg[2], run->arg[3], run->arg[4],
+			sweep_outcome(run), death, (unsigned long long)o->meals,
+			o->hunger / 1000.0, run->arg[1] - o->hunger / 1000.0, jitter, sep);
+}
+
+/*
+sweep_print(): Prints the results of a sweep on stdout.
+
+Parameters: sw - A pointer to the sweep.
+
+Return value: None.
+
+How it works:
+1. In CSV, prints a header and one row per run.
+2. In JSON, prints an array with one object per run.
+*/
+void	sweep_print(t_sweep *sw)
+{
+	int	i;
+
+	if (sw->opts.sweep == SWEEP_CSV)
+		printf("n_philos,ms_todie,ms_toeat,ms_tosleep,n_meals,outcome,"
+			"death_ms,meals,max_hunger_ms,margin_ms,jitter_ms\n");
+	else
+		printf("[\n");
+	i = -1;
+	while (++i < sw->n_runs)
+	{
+		if (i + 1 < sw->n_runs)
+			sweep_row(&sw->runs[i], sw->opts.sweep, ",");
+		else
+			sweep_row(&sw->runs[i], sw->opts.sweep, "");
+	}
+	if (sw->opts.sweep == SWEEP_JSON)
+		printf("]\n");
+}
@@ -0,0 +1,192 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sweep_run.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:33:17 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 02:41:15 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+sweep_config(): Finds the arguments of one run of a sweep.
+
+Parameters: sw - A pointer to the sweep.
+            i - The index of the run.
+
+Return value: None.
+
+How it works:
+1. Reads i as a number whose digits index the ranges, the meal count
+	being the lowest one, so the rows come out sorted by n_philos first.
+*/
+static void	sweep_config(t_sweep *sw, int i)
+{
+	t_range	*r;
+	int		rest;
+	int		k;
+
+	rest = i;
+	k = SWEEP_ARGS;
+	while (--k >= 0)
+	{
+		r = &sw->range[k];
+		sw->runs[i].arg[k] = (int)(r->lo + (rest % r->n) * r->step);
+		rest /= r->n;
+	}
+}
+
+/*
+sweep_predict(): Fills a run of a sweep from its prediction, if it is not
+				to be run.
+
+Parameters: run - A pointer to the run.
+            mode - PREDICT_REPORT or PREDICT_ONLY.
+
+Return value: 1 if the run was filled and must be skipped, 0 otherwise.
+
+How it works:
+1. Predicts the run. With --predict, only runs expected to die are
+	skipped; with --predict-only, every run is.
+2. Fills the outcome as a live run would, with no meals counted: the
+	period is the longest wait for a meal and there is no jitter.
+*/
+static int	sweep_predict(t_sweep_run *run, t_predict_mode mode)
+{
+	t_predict	p;
+
+	predict(&p, run->arg);
+	if (mode != PREDICT_ONLY && p.death_us < 0)
+		return (0);
+	memset(&run->out, 0, sizeof(t_outcome));
+	run->predicted = 1;
+	run->out.died = (p.death_us >= 0);
+	run->out.death_us = p.death_us;
+	run->out.hunger = p.period_us;
+	run->out.period_min = p.period_us;
+	run->out.period_max = p.period_us;
+	return (1);
+}
+
+/*
+sweep_one(): Runs one configuration of a sweep.
+
+Parameters: sw - A pointer to the sweep.
+            run - A pointer to the run.
+
+Return value: None.
+
+How it works:
+0. With --predict, may fill the run from predict() instead, see
+	sweep_predict.
+1. Writes the run's arguments out as a command line, so it goes through
+	philo() exactly like a single run.
+2. Points the options to the run's outcome: the log writer then records
+	the events there instead of printing them.
+3. Marks the run as failed if it cannot be set up.
+*/
+static void	sweep_one(t_sweep *sw, t_sweep_run *run)
+{
+	char	buf[SWEEP_ARGS][12];
+	char	*av[SWEEP_ARGS + 2];
+	t_opts	opts;
+	int		k;
+
+	if (sw->opts.predict && sweep_predict(run, sw->opts.predict))
+		return ;
+	av[0] = "philo";
+	k = -1;
+	while (++k < SWEEP_ARGS)
+	{
+		snprintf(buf[k], sizeof(buf[k]), "%d", run->arg[k]);
+		av[k + 1] = buf[k];
+	}
+	av[SWEEP_ARGS + 1] = NULL;
+	memset(&run->out, 0, sizeof(t_outcome));
+	run->out.period_min = DES_NEVER;
+	run->out.last = calloc(run->arg[0], sizeof(u_int64_t));
+	opts = sw->opts;
+	opts.outcome = &run->out;
+	run->err = !run->out.last || philo(SWEEP_ARGS + 1, av, &opts);
+	free(run->out.last);
+}
+
+/*
+sweep_runner(): The routine of a sweep runner thread.
+
+Parameters: sw_p - A void pointer to the sweep.
+			This is cast to a t_sweep pointer within the function.
+
+Return value: NULL.
+
+How it works:
+1. Binds the thread to a virtual clock of its own, reset before each run,
+	so runs in virtual time do not share one.
+2. Takes the next run until none is left.
+*/
+static void	*sweep_runner(void *sw_p)
+{
+	t_sweep				*sw;
+	_Atomic u_int64_t	clock;
+	_Atomic u_int64_t	*old;
+	int					i;
+
+	sw = (t_sweep *)sw_p;
+	old = virtual_clock();
+	virtual_bind(&clock);
+	i = atomic_fetch_add(&sw->next, 1);
+	while (i < sw->n_runs)
+	{
+		atomic_store(&clock, 0);
+		sweep_one(sw, &sw->runs[i]);
+		i = atomic_fetch_add(&sw->next, 1);
+	}
+	virtual_bind(old);
+	return (NULL);
+}
+
+/*
+sweep_start(): Runs every configuration of a sweep.
+
+Parameters: sw - A pointer to the sweep.
+
+Return value: 0 on success, 1 if memory cannot be allocated.
+
+How it works:
+1. Finds the arguments of every run.
+2. Starts one runner per online core, no more than there are runs; the
+	calling thread is one of them. If a thread cannot be created, the
+	others take its share.
+3. Waits for every runner.
+*/
+int	sweep_start(t_sweep *sw)
+{
+	pthread_t	*th;
+	long		n;
+	int			i;
+
+	i = -1;
+	while (++i < sw->n_runs)
+		sweep_config(sw, i);
+	n = sysconf(_SC_NPROCESSORS_ONLN);
+	if (n > sw->n_runs)
+		n = sw->n_runs;
+	if (n < 1)
+		n = 1;
+	th = malloc(sizeof(pthread_t) * n);
+	if (!th)
+		return (1);
+	atomic_init(&sw->next, 0);
+	i = 1;
+	while (i < n && !pthread_create(&th[i], NULL, &sweep_runner, sw))
+		i++;
+	sweep_runner(sw);
+	while (--i > 0)
+		pthread_join(th[i], NULL);
+	free(th);
+	return (0);
+}
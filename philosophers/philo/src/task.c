@@ -0,0 +1,183 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   task.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:10:50 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 04:24:17 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+task_start(): First step of a task: the start of routine().
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            i - The index of the philosopher.
+            wake - Where to store the time to resume the task at.
+
+Return value: RUN_TIMER for even ids, which wait a bit to avoid all
+				reaching for the same forks at once, RUN_READY otherwise.
+				The fork wait starts then, for --stats.
+*/
+static t_run	task_start(t_data *data, int i, u_int64_t *wake)
+{
+	update_last_meal(&data->philo[i]);
+	data->pool.steps[i] = STEP_FIRST;
+	data->philo[i].hot->since = get_time();
+	if (data->philo[i].id % 2 == 1)
+		return (RUN_READY);
+	*wake = get_time() + pull_eat_time(data) - 10000;
+	data->philo[i].hot->since = *wake;
+	return (RUN_TIMER);
+}
+
+/*
+task_forks(): Takes the forks, in the order take_both() uses, and starts
+				eating.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            i - The index of the philosopher.
+            wake - Where to store the time to resume the task at.
+
+Return value: RUN_PARKED if a fork is taken: the task is resumed when the
+				neighbour drops it. RUN_TIMER once eating, until the meal
+				is over.
+
+How it works:
+1. Even ids take the right fork first, odd ids the left one. The step
+	records whether the first fork is already held.
+2. With both forks, sets the state to EATING and updates the last meal,
+	as eat() does.
+*/
+static t_run	task_forks(t_data *data, int i, u_int64_t *wake)
+{
+	t_philo	*philo;
+	t_fork	*first;
+	t_fork	*second;
+
+	philo = &data->philo[i];
+	first = philo->left_f;
+	second = philo->right_f;
+	if (philo->id % 2 == 0)
+		first = philo->right_f;
+	if (philo->id % 2 == 0)
+		second = philo->left_f;
+	if (data->pool.steps[i] == STEP_FIRST && !pfork_take(data, i, first))
+		return (RUN_PARKED);
+	if (data->pool.steps[i] == STEP_FIRST)
+		print_changestate(data, philo->id, MSG_FORK);
+	data->pool.steps[i] = STEP_SECOND;
+	if (!pfork_take(data, i, second))
+		return (RUN_PARKED);
+	print_changestate(data, philo->id, MSG_FORK);
+	push_philo_state(philo, EATING);
+	print_changestate(data, philo->id, MSG_EAT);
+	update_last_meal(philo);
+	data->pool.steps[i] = STEP_EATEN;
+	*wake = get_time() + pull_eat_time(data);
+	return (RUN_TIMER);
+}
+
+/*
+task_eaten(): Ends a meal and falls asleep, as eat() then ft_sleep() do.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            i - The index of the philosopher.
+            wake - Where to store the time to resume the task at.
+
+Return value: RUN_TIMER until the philosopher wakes up, or RUN_DONE if it
+				died in the meantime.
+
+How it works:
+1. Adds the time from the start of the fork wait to the start of the meal
+	to the wait span, as take_both() does.
+2. Counts the meal and drops the forks. The sleep starts now, for --stats.
+*/
+static t_run	task_eaten(t_data *data, int i, u_int64_t *wake)
+{
+	t_philo	*philo;
+
+	philo = &data->philo[i];
+	stats_span(&philo->hot->stats[STAT_WAIT],
+		pull_last_meal(philo) - philo->hot->since);
+	update_n_meals(philo);
+	pfork_drop(data, i, philo->left_f);
+	pfork_drop(data, i, philo->right_f);
+	push_philo_state(philo, SLEEPING);
+	if (pull_philo_state(philo) == DEAD)
+		return (RUN_DONE);
+	print_changestate(data, philo->id, MSG_SLEEP);
+	data->pool.steps[i] = STEP_SLEPT;
+	philo->hot->since = get_time();
+	*wake = philo->hot->since + pull_sleep_time(data);
+	return (RUN_TIMER);
+}
+
+/*
+task_slept(): Wakes up and thinks, as think() does.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            i - The index of the philosopher.
+            wake - Where to store the time to resume the task at.
+
+Return value: RUN_TIMER while thinking on odd tables, RUN_READY to go for
+				the forks right away, or RUN_DONE if the philosopher died.
+
+How it works:
+1. Adds how long the sleep really lasted to the sleep span, as ft_sleep()
+	does, and starts the fork wait when the thinking is over.
+*/
+static t_run	task_slept(t_data *data, int i, u_int64_t *wake)
+{
+	t_philo	*philo;
+
+	philo = &data->philo[i];
+	stats_span(&philo->hot->stats[STAT_SLEEP], get_time() - philo->hot->since);
+	push_philo_state(philo, THINKING);
+	if (pull_philo_state(philo) == DEAD)
+		return (RUN_DONE);
+	print_changestate(data, philo->id, MSG_THINK);
+	data->pool.steps[i] = STEP_FIRST;
+	philo->hot->since = get_time() + think_time(data);
+	if (!think_time(data))
+		return (RUN_READY);
+	*wake = philo->hot->since;
+	return (RUN_TIMER);
+}
+
+/*
+task_step(): Runs a philosopher task until it has to wait.
+
+Parameters: data - A pointer to the data structure that holds
+				the simulation data.
+            i - The index of the philosopher.
+            wake - Where to store the time to resume the task at, when
+				RUN_TIMER is returned.
+
+Return value: What the task waits for: RUN_READY to run again, RUN_TIMER
+				for wake, RUN_PARKED for a fork, RUN_DONE when it is over.
+
+How it works:
+1. Ends the task once the philosopher is dead or the simulation stopped.
+2. Otherwise, runs the part of routine() its step is at.
+*/
+t_run	task_step(t_data *data, int i, u_int64_t *wake)
+{
+	if (pull_philo_state(&data->philo[i]) == DEAD || !pull_keep_iter(data))
+		return (RUN_DONE);
+	if (data->pool.steps[i] == STEP_START)
+		return (task_start(data, i, wake));
+	if (data->pool.steps[i] == STEP_EATEN)
+		return (task_eaten(data, i, wake));
+	if (data->pool.steps[i] == STEP_SLEPT)
+		return (task_slept(data, i, wake));
+	return (task_forks(data, i, wake));
+}
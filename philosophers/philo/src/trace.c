@@ -0,0 +1,165 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:07:13 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 02:07:13 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/*
+trace_map(): Maps the window of the trace file starting at map_off.
+
+Parameters: trace - A pointer to the trace.
+            map_off - The file offset of the window, a multiple of
+				TRACE_CHUNK.
+
+Return value: 0 if the window is mapped, 1 otherwise.
+
+How it works:
+1. Unmaps the previous window, if any.
+2. Grows the file so the window is backed, then maps it shared, so stores
+	to it are the file writes.
+*/
+static int	trace_map(t_trace *trace, u_int64_t map_off)
+{
+	if (trace->map)
+		munmap(trace->map, TRACE_CHUNK);
+	trace->map = NULL;
+	if (ftruncate(trace->fd, map_off + TRACE_CHUNK) != 0)
+		return (1);
+	trace->map = mmap(NULL, TRACE_CHUNK, PROT_READ | PROT_WRITE, MAP_SHARED,
+			trace->fd, map_off);
+	if (trace->map == MAP_FAILED)
+	{
+		trace->map = NULL;
+		return (1);
+	}
+	trace->map_off = map_off;
+	return (0);
+}
+
+/*
+trace_open(): Creates the trace file and maps its first window.
+
+Parameters: trace - A pointer to the trace.
+            path - The path of the file.
+
+Return value: 0 if the file is ready, 1 otherwise.
+
+How it works:
+1. Creates or truncates the file.
+2. Leaves room for the header, written by trace_close() once the number
+	of records is known, and maps the first window.
+*/
+int	trace_open(t_trace *trace, char *path)
+{
+	trace->map = NULL;
+	trace->off = sizeof(t_trace_hdr);
+	trace->last_ts = 0;
+	trace->n_recs = 0;
+	trace->fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (trace->fd < 0)
+		return (1);
+	if (trace_map(trace, 0))
+	{
+		close(trace->fd);
+		trace->fd = -1;
+		return (1);
+	}
+	return (0);
+}
+
+/*
+trace_put(): Appends one record to the trace.
+
+Parameters: trace - A pointer to the trace.
+            delta - The time since the previous record, in microseconds.
+            id_msg - The philosopher id and the message.
+
+Return value: None.
+
+How it works:
+1. If the window is full, maps the next one. If that fails, records are
+	dropped from then on.
+2. Stores the record in the window.
+*/
+static void	trace_put(t_trace *trace, u_int32_t delta, u_int32_t id_msg)
+{
+	t_trace_rec	*rec;
+
+	if (trace->map && trace->off == trace->map_off + TRACE_CHUNK)
+		trace_map(trace, trace->map_off + TRACE_CHUNK);
+	if (!trace->map)
+		return ;
+	rec = (t_trace_rec *)(trace->map + (trace->off - trace->map_off));
+	rec->delta = delta;
+	rec->id_msg = id_msg;
+	trace->off += sizeof(t_trace_rec);
+	trace->n_recs++;
+}
+
+/*
+trace_record(): Records an event in the trace.
+
+Parameters: trace - A pointer to the trace.
+            ts - The time of the event since the start of the simulation,
+				in microseconds. Events come in timestamp order.
+            id - The id of the philosopher.
+            msg - The message.
+
+Return value: None.
+
+How it works:
+1. Encodes the time as the delta from the previous record. Deltas that do
+	not fit in 32 bits are split with TRACE_GAP records.
+*/
+void	trace_record(t_trace *trace, u_int64_t ts, int id, t_msg msg)
+{
+	u_int64_t	delta;
+
+	delta = ts - trace->last_ts;
+	while (delta > 0xFFFFFFFFULL)
+	{
+		trace_put(trace, 0xFFFFFFFFU, TRACE_GAP);
+		delta -= 0xFFFFFFFFULL;
+	}
+	trace_put(trace, (u_int32_t)delta, (u_int32_t)id << 8 | msg);
+	trace->last_ts = ts;
+}
+
+/*
+trace_close(): Finishes the trace file.
+
+Parameters: trace - A pointer to the trace.
+            n_philos - The number of philosophers.
+
+Return value: None.
+
+How it works:
+1. Unmaps the window and trims the file to the records written.
+2. Writes the header with the number of records, and closes the file.
+*/
+void	trace_close(t_trace *trace, int n_philos)
+{
+	t_trace_hdr	hdr;
+
+	if (trace->map)
+		munmap(trace->map, TRACE_CHUNK);
+	if (ftruncate(trace->fd, trace->off) != 0)
+		write(2, "philo: cannot trim the trace\n", 29);
+	memset(&hdr, 0, sizeof(hdr));
+	hdr.magic = TRACE_MAGIC;
+	hdr.version = TRACE_VERSION;
+	hdr.n_philos = n_philos;
+	hdr.rec_size = sizeof(t_trace_rec);
+	hdr.n_recs = trace->n_recs;
+	if (pwrite(trace->fd, &hdr, sizeof(hdr), 0) != sizeof(hdr))
+		write(2, "philo: cannot write the trace header\n", 37);
+	close(trace->fd);
+}
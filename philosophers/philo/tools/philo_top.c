@@ -0,0 +1,191 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   philo_top.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:39:15 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 04:28:03 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_top.h"
+
+/*
+top_size(): Returns the size of a metrics page.
+
+Parameters: n_philos - The number of philosophers in it.
+
+Return value: The size of the header and of one entry per philosopher.
+*/
+static size_t	top_size(u_int32_t n_philos)
+{
+	return (sizeof(t_metrics_hdr) + n_philos * sizeof(t_metrics_philo));
+}
+
+/*
+top_attach(): Maps a metrics page written by philo --metrics.
+
+Parameters: path - The path of the page.
+            top - Where to store the mapping and a buffer as large as the
+				page, for top_snapshot().
+
+Return value: 0 on success, 1 if the file cannot be read or is not a
+				complete metrics page, or the buffer cannot be allocated.
+
+How it works:
+1. Maps the whole file read-only and shared, so every update of the
+	simulation shows through. philo_top never writes to it, and so never
+	slows the simulation down. The file stays open, for top_snapshot() to
+	check its size.
+2. Checks the magic number and the version, and that the file holds an
+	entry for every philosopher.
+3. Allocates the buffer for the snapshots.
+*/
+int	top_attach(char *path, t_top *top)
+{
+	struct stat		st;
+
+	memset(top, 0, sizeof(t_top));
+	top->fd = open(path, O_RDONLY);
+	if (top->fd < 0)
+		return (1);
+	top->page = MAP_FAILED;
+	if (fstat(top->fd, &st) == 0
+		&& (size_t)st.st_size >= sizeof(t_metrics_hdr))
+		top->page = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED,
+				top->fd, 0);
+	if (top->page == MAP_FAILED)
+		return (1);
+	if (top->page->magic != METRICS_MAGIC
+		|| top->page->version != METRICS_VERSION
+		|| (size_t)st.st_size < top_size(top->page->n_philos))
+		return (1);
+	top->len = top_size(top->page->n_philos);
+	top->seq = 1;
+	top->snap = malloc(top->len);
+	return (!top->snap);
+}
+
+/*
+top_fresh(): Checks a copy of the page, and that the page still moves.
+
+Parameters: top - The mapped page, its last copy in top->snap.
+            seq - The seq the copy was taken at, odd if none was ever taken.
+
+Return value: 0 if the copy can be shown, 1 after writing why not.
+
+How it works:
+1. A copy of another page, written over this one by a new run, may hold
+	more philosophers than the buffer: rejects it.
+2. Counts the copies in a row that saw the same seq, and gives up after
+	TOP_STALE of them, or at once if no copy was ever taken. A killed
+	simulation leaves running at 1, and would otherwise be watched forever.
+*/
+static int	top_fresh(t_top *top, u_int64_t seq)
+{
+	if (!(seq & 1) && (top->snap->magic != METRICS_MAGIC
+			|| top_size(top->snap->n_philos) != top->len))
+	{
+		write(2, "philo_top: the metrics page was replaced\n", 41);
+		return (1);
+	}
+	if (seq != top->seq)
+		top->stale = 0;
+	top->seq = seq;
+	if (!(seq & 1) && ++top->stale <= TOP_STALE)
+		return (0);
+	write(2, "philo_top: the simulation stopped updating the page\n", 52);
+	return (1);
+}
+
+/*
+top_snapshot(): Copies a consistent snapshot of a metrics page.
+
+Parameters: top - The mapped page, copied to top->snap.
+
+Return value: 0 if the snapshot can be shown, 1 if the page was truncated,
+				replaced or stopped moving.
+
+How it works:
+1. Checks the size of the file first: a new run truncates it before it
+	grows it again, and reading past its end would raise SIGBUS.
+2. Reads seq, and waits while it is odd: the simulation is updating. After
+	TOP_SPINS yields, keeps the last snapshot, as if seq had not moved.
+	top_attach() sets top->seq to 1, odd, until the first copy.
+3. Copies the page, then reads seq again. If it changed, the copy may mix
+	two updates: copies again. Neither side ever waits for a lock.
+*/
+int	top_snapshot(t_top *top)
+{
+	struct stat	st;
+	u_int64_t	seq;
+	int			spins;
+
+	spins = 0;
+	while (1)
+	{
+		if (fstat(top->fd, &st) || (size_t)st.st_size < top->len)
+		{
+			write(2, "philo_top: the metrics page was truncated\n", 42);
+			return (1);
+		}
+		seq = atomic_load_explicit(&top->page->seq, memory_order_acquire);
+		if (!(seq & 1) || ++spins > TOP_SPINS)
+		{
+			if (seq & 1)
+				return (top_fresh(top, top->seq));
+			memcpy(top->snap, top->page, top->len);
+			atomic_thread_fence(memory_order_acquire);
+			if (atomic_load_explicit(&top->page->seq,
+					memory_order_relaxed) == seq)
+				return (top_fresh(top, seq));
+		}
+		sched_yield();
+	}
+}
+
+/*
+main(): Shows the live metrics of a simulation run with philo --metrics.
+
+Parameters: ac - The count of command-line arguments.
+            av - philo_top [--once] <file>
+
+Return value: 0 on success, 1 if the arguments or the page are invalid, or
+				the page was truncated, replaced or stopped moving.
+
+How it works:
+1. Maps the page and allocates a buffer for its snapshots.
+2. Every TOP_REFRESH_US, takes a snapshot and redraws the screen with it,
+	until the simulation is over or top_snapshot() gives up on it. With
+	--once, prints one snapshot without clearing the screen.
+*/
+int	main(int ac, char **av)
+{
+	t_top	top;
+	int		err;
+
+	if (ac != 2 && !(ac == 3 && !strcmp(av[1], "--once")))
+	{
+		write(2, "usage: philo_top [--once] <file>\n", 33);
+		return (1);
+	}
+	if (top_attach(av[ac - 1], &top))
+	{
+		write(2, "philo_top: cannot read the metrics page\n", 40);
+		return (1);
+	}
+	err = top_snapshot(&top);
+	if (!err)
+		top_render(top.snap, ac == 2);
+	while (!err && ac == 2 && top.snap->running)
+	{
+		usleep(TOP_REFRESH_US);
+		err = top_snapshot(&top);
+		if (!err)
+			top_render(top.snap, 1);
+	}
+	free(top.snap);
+	return (err);
+}
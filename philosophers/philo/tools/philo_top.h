@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   philo_top.h                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:39:15 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 04:28:03 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PHILO_TOP_H
+# define PHILO_TOP_H
+
+# include "../include/philo.h"
+# include <sys/stat.h> //fstat(): size of the metrics page
+
+/*
+philo_top redraws the page every TOP_REFRESH_US, with at most TOP_ROWS
+philosophers; the rest are counted on the last line.
+*/
+# define TOP_REFRESH_US 200000
+# define TOP_ROWS 40
+
+/*
+philo_top gives up when seq has not moved for TOP_STALE refreshes: the page
+is written every METRICS_PERIOD_US, so the simulation was killed or stopped.
+A copy waits at most TOP_SPINS yields for an odd seq to turn even, in case it
+was killed in the middle of an update.
+*/
+# define TOP_STALE 10
+# define TOP_SPINS 100000
+
+/*
+A mapped metrics page, for philo_top.
+
+page  - The page, mapped read-only and shared.
+snap  - The last consistent copy of it, len bytes.
+len   - The size of the page when it was mapped.
+fd    - The file, kept open to check its size before every copy.
+seq   - The seq of the last copy.
+stale - How many copies in a row saw that same seq.
+*/
+typedef struct s_top
+{
+	t_metrics_hdr	*page;
+	t_metrics_hdr	*snap;
+	size_t			len;
+	int				fd;
+	u_int64_t		seq;
+	int				stale;
+}	t_top;
+
+///////////////////
+/////philo_top/////
+///////////////////
+int				top_attach(char *path, t_top *top);
+int				top_snapshot(t_top *top);
+
+////////////////////
+/////top_render/////
+////////////////////
+void			top_render(t_metrics_hdr *snap, int clear);
+
+#endif
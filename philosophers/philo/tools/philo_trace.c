@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   philo_trace.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:08:00 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 02:08:00 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_trace.h"
+
+/*
+trace_load(): Maps a trace file and checks its header.
+
+Parameters: path - The path of the trace file.
+            hdr - Where to copy the header.
+
+Return value: A pointer to the first record, or NULL if the file cannot be
+				read or is not a complete trace.
+
+How it works:
+1. Maps the whole file read-only.
+2. Checks the magic number, the version and the record size, and that the
+	file holds as many records as the header says.
+*/
+t_trace_rec	*trace_load(char *path, t_trace_hdr *hdr)
+{
+	struct stat	st;
+	char		*map;
+	int			fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return (NULL);
+	map = MAP_FAILED;
+	if (fstat(fd, &st) == 0 && (size_t)st.st_size >= sizeof(t_trace_hdr))
+		map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		return (NULL);
+	memcpy(hdr, map, sizeof(t_trace_hdr));
+	if (hdr->magic != TRACE_MAGIC || hdr->version != TRACE_VERSION
+		|| hdr->rec_size != sizeof(t_trace_rec)
+		|| (st.st_size - sizeof(t_trace_hdr)) / sizeof(t_trace_rec)
+		< hdr->n_recs)
+		return (NULL);
+	return ((t_trace_rec *)(map + sizeof(t_trace_hdr)));
+}
+
+/*
+trace_decode(): Prints a trace in the text format of philo.
+
+Parameters: hdr - The header of the trace.
+            recs - The records of the trace.
+
+Return value: None.
+
+How it works:
+1. Rebuilds each timestamp by adding up the deltas, skipping TRACE_GAP
+	records and unknown messages.
+2. Formats each line with log_format, into a buffer written to stdout each
+	time it fills up, exactly as the log writer does.
+*/
+void	trace_decode(t_trace_hdr *hdr, t_trace_rec *recs)
+{
+	static char	buf[LOG_BUF_SIZE];
+	size_t		len;
+	u_int64_t	ts;
+	u_int64_t	i;
+
+	len = 0;
+	ts = 0;
+	i = -1;
+	while (++i < hdr->n_recs)
+	{
+		ts += recs[i].delta;
+		if ((recs[i].id_msg & 0xFF) > MSG_DIED)
+			continue ;
+		if (len + LOG_LINE_MAX > LOG_BUF_SIZE)
+		{
+			if (write(1, buf, len) < 0)
+				return ;
+			len = 0;
+		}
+		len += log_format(buf + len, ts / 1000, recs[i].id_msg >> 8,
+				(t_msg)(recs[i].id_msg & 0xFF));
+	}
+	if (len && write(1, buf, len) < 0)
+		return ;
+}
+
+/*
+main(): Converts a binary trace written with philo --trace back to text.
+
+Parameters: ac - The count of command-line arguments.
+            av - philo_trace [--summary] <file>
+
+Return value: 0 on success, 1 if the arguments or the file are invalid.
+
+How it works:
+1. Loads the trace.
+2. Prints it as text, or with --summary, prints its summary instead.
+*/
+int	main(int ac, char **av)
+{
+	t_trace_hdr	hdr;
+	t_trace_rec	*recs;
+
+	if (ac != 2 && !(ac == 3 && !strcmp(av[1], "--summary")))
+	{
+		write(2, "usage: philo_trace [--summary] <file>\n", 38);
+		return (1);
+	}
+	recs = trace_load(av[ac - 1], &hdr);
+	if (!recs)
+	{
+		write(2, "philo_trace: not a complete philo trace\n", 40);
+		return (1);
+	}
+	if (ac == 3)
+		return (trace_summary(&hdr, recs));
+	trace_decode(&hdr, recs);
+	return (0);
+}
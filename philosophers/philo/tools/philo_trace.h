@@ -0,0 +1,46 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   philo_trace.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:07:48 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 02:07:48 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PHILO_TRACE_H
+# define PHILO_TRACE_H
+
+# include "../include/philo.h"
+# include <sys/stat.h> //fstat(): size of the trace file
+
+/*
+t_summary: what philo_trace --summary accumulates over a trace. gap is the
+longest time a philosopher went without starting a meal, the post-mortem
+figure to compare with time to die.
+*/
+typedef struct s_summary
+{
+	u_int64_t	counts[MSG_DIED + 1];
+	u_int64_t	*meals;
+	u_int64_t	*last_eat;
+	u_int64_t	gap;
+	int			gap_id;
+	u_int64_t	died;
+	int			died_id;
+}	t_summary;
+
+/////////////////////
+/////philo_trace/////
+/////////////////////
+t_trace_rec	*trace_load(char *path, t_trace_hdr *hdr);
+void		trace_decode(t_trace_hdr *hdr, t_trace_rec *recs);
+
+///////////////////////
+/////trace_summary/////
+///////////////////////
+int			trace_summary(t_trace_hdr *hdr, t_trace_rec *recs);
+
+#endif
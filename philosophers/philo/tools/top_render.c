@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   top_render.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:39:32 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:41:54 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_top.h"
+
+/*
+top_state(): Returns the name of a philosopher state.
+
+Parameters: state - The state, as stored in the page.
+
+Return value: Its name, or "?" for an unknown state.
+*/
+static char	*top_state(u_int32_t state)
+{
+	if (state == EATING)
+		return ("eating");
+	if (state == SLEEPING)
+		return ("sleeping");
+	if (state == THINKING)
+		return ("thinking");
+	if (state == DEAD)
+		return ("dead");
+	if (state == FULL)
+		return ("full");
+	if (state == IDLE)
+		return ("idle");
+	return ("?");
+}
+
+/*
+top_left(): Returns how long a philosopher has left before it dies.
+
+Parameters: snap - A pointer to the snapshot.
+            p - A pointer to the philosopher's entry.
+
+Return value: Time to die minus the age of its last meal, in milliseconds,
+				negative once it is past its deadline.
+*/
+static double	top_left(t_metrics_hdr *snap, t_metrics_philo *p)
+{
+	return (((int64_t)snap->us_todie - (int64_t)p->meal_age_us) / 1000.0);
+}
+
+/*
+top_closest(): Finds the philosopher closest to its deadline.
+
+Parameters: snap - A pointer to the snapshot.
+
+Return value: The index of the philosopher that has gone the longest
+				without starting a meal, among those not eating, or -1 if
+				they are all eating.
+*/
+static int	top_closest(t_metrics_hdr *snap)
+{
+	t_metrics_philo	*p;
+	int				best;
+	u_int32_t		i;
+
+	p = (t_metrics_philo *)(snap + 1);
+	best = -1;
+	i = 0;
+	while (i < snap->n_philos)
+	{
+		if (p[i].state != EATING && (best < 0
+				|| p[i].meal_age_us > p[best].meal_age_us))
+			best = i;
+		i++;
+	}
+	return (best);
+}
+
+/*
+top_header(): Prints the global figures of a snapshot.
+
+Parameters: snap - A pointer to the snapshot.
+
+Return value: None.
+
+How it works:
+1. Prints the number of philosophers, the time since the start, and
+	whether the simulation is still running.
+2. Prints the meals, the meals per second over the last second, and how
+	late the death monitor last woke up for a deadline.
+3. Prints the philosopher closest to its deadline, if any.
+*/
+static void	top_header(t_metrics_hdr *snap)
+{
+	int	i;
+
+	printf("philo_top: %u philosophers, %.1f s, ", snap->n_philos,
+		snap->elapsed_us / 1e6);
+	if (snap->running)
+		printf("running\n");
+	else
+		printf("over\n");
+	printf("meals: %llu, %.1f meals/s, monitor lag %.3f ms\n",
+		(unsigned long long)snap->meals, snap->meals_per_s,
+		snap->monitor_lag_us / 1000.0);
+	i = top_closest(snap);
+	if (i >= 0)
+		printf("closest to death: %d, %.1f ms left\n", i + 1,
+			top_left(snap, (t_metrics_philo *)(snap + 1) + i));
+	printf("\n%5s  %-9s %6s %12s %10s\n", "id", "state", "meals",
+		"meal age ms", "left ms");
+}
+
+/*
+top_render(): Prints a snapshot of a metrics page.
+
+Parameters: snap - A pointer to the snapshot.
+            clear - 1 to clear the terminal first, 0 to just print.
+
+Return value: None.
+
+How it works:
+1. Prints the global figures with top_header().
+2. Prints a row per philosopher, up to TOP_ROWS, then how many more
+	there are.
+*/
+void	top_render(t_metrics_hdr *snap, int clear)
+{
+	t_metrics_philo	*p;
+	u_int32_t		i;
+
+	if (clear)
+		printf("\033[H\033[J");
+	top_header(snap);
+	p = (t_metrics_philo *)(snap + 1);
+	i = 0;
+	while (i < snap->n_philos && i < TOP_ROWS)
+	{
+		printf("%5u  %-9s %6u %12.1f %10.1f\n", i + 1, top_state(p[i].state),
+			p[i].meals, p[i].meal_age_us / 1000.0, top_left(snap, &p[i]));
+		i++;
+	}
+	if (snap->n_philos > TOP_ROWS)
+		printf("  ... %u more\n", snap->n_philos - TOP_ROWS);
+	fflush(stdout);
+}
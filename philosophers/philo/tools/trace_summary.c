@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace_summary.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pmelis <pmelis@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:08:17 by pmelis            #+#    #+#             */
+/*   Updated: 2026/10/18 02:08:17 by pmelis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_trace.h"
+
+/*
+summary_add(): Accounts one event in the summary.
+
+Parameters: s - A pointer to the summary.
+            ts - The time of the event, in microseconds.
+            id - The id of the philosopher.
+            msg - The message.
+
+Return value: None.
+
+How it works:
+1. Counts the event.
+2. On a meal or a death, measures how long the philosopher went since its
+	previous meal, or since the start, and keeps the longest such gap.
+3. Counts meals and remembers the death.
+*/
+static void	summary_add(t_summary *s, u_int64_t ts, int id, t_msg msg)
+{
+	s->counts[msg]++;
+	if (msg != MSG_EAT && msg != MSG_DIED)
+		return ;
+	if (ts - s->last_eat[id - 1] > s->gap)
+	{
+		s->gap = ts - s->last_eat[id - 1];
+		s->gap_id = id;
+	}
+	if (msg == MSG_EAT)
+	{
+		s->last_eat[id - 1] = ts;
+		s->meals[id - 1]++;
+		return ;
+	}
+	s->died = ts;
+	s->died_id = id;
+}
+
+/*
+summary_meals(): Prints the fewest, average and most meals per philosopher.
+
+Parameters: s - A pointer to the summary.
+            n_philos - The number of philosophers.
+
+Return value: None.
+*/
+static void	summary_meals(t_summary *s, int n_philos)
+{
+	u_int64_t	min;
+	u_int64_t	max;
+	int			i;
+
+	min = s->meals[0];
+	max = s->meals[0];
+	i = 0;
+	while (++i < n_philos)
+	{
+		if (s->meals[i] < min)
+			min = s->meals[i];
+		if (s->meals[i] > max)
+			max = s->meals[i];
+	}
+	printf("meals_per_philo: min %llu avg %.2f max %llu\n",
+		(unsigned long long)min, (double)s->counts[MSG_EAT] / n_philos,
+		(unsigned long long)max);
+}
+
+/*
+summary_print(): Prints the summary of a trace.
+
+Parameters: s - A pointer to the summary.
+            hdr - The header of the trace.
+            end - The time of the last event, in microseconds.
+
+Return value: None.
+*/
+static void	summary_print(t_summary *s, t_trace_hdr *hdr, u_int64_t end)
+{
+	printf("philos: %u\nrecords: %llu\nduration_ms: %llu\n", hdr->n_philos,
+		(unsigned long long)hdr->n_recs, (unsigned long long)end / 1000);
+	printf("events: fork %llu eat %llu sleep %llu think %llu died %llu\n",
+		(unsigned long long)s->counts[MSG_FORK],
+		(unsigned long long)s->counts[MSG_EAT],
+		(unsigned long long)s->counts[MSG_SLEEP],
+		(unsigned long long)s->counts[MSG_THINK],
+		(unsigned long long)s->counts[MSG_DIED]);
+	summary_meals(s, hdr->n_philos);
+	printf("max_meal_gap_ms: %llu (philo %d)\n",
+		(unsigned long long)s->gap / 1000, s->gap_id);
+	if (s->counts[MSG_DIED])
+		printf("died: %llu %d\n", (unsigned long long)s->died / 1000,
+			s->died_id);
+	else
+		printf("died: none\n");
+}
+
+/*
+trace_summary(): Prints the summary of a trace instead of its lines.
+
+Parameters: hdr - The header of the trace.
+            recs - The records of the trace.
+
+Return value: 0 on success, 1 if the trace is empty of philosophers or
+				memory cannot be allocated.
+
+How it works:
+1. Replays the records, rebuilding the timestamps from the deltas and
+	skipping TRACE_GAP records, unknown messages and unknown ids.
+2. Prints the event counts, the meals per philosopher, the longest gap
+	between two meals of one philosopher, and the death, if any.
+*/
+int	trace_summary(t_trace_hdr *hdr, t_trace_rec *recs)
+{
+	t_summary	s;
+	u_int64_t	ts;
+	u_int64_t	i;
+	u_int32_t	id;
+
+	memset(&s, 0, sizeof(s));
+	s.meals = calloc(hdr->n_philos + 1, sizeof(u_int64_t));
+	s.last_eat = calloc(hdr->n_philos + 1, sizeof(u_int64_t));
+	ts = 0;
+	i = -1;
+	while (hdr->n_philos && s.meals && s.last_eat && ++i < hdr->n_recs)
+	{
+		ts += recs[i].delta;
+		id = recs[i].id_msg >> 8;
+		if ((recs[i].id_msg & 0xFF) <= MSG_DIED && id >= 1
+			&& id <= hdr->n_philos)
+			summary_add(&s, ts, id, (t_msg)(recs[i].id_msg & 0xFF));
+	}
+	if (hdr->n_philos && s.meals && s.last_eat)
+		summary_print(&s, hdr, ts);
+	free(s.meals);
+	free(s.last_eat);
+	return (!hdr->n_philos || !s.meals || !s.last_eat);
+}